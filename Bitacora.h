@@ -0,0 +1,73 @@
+/**
+ * @file Bitacora.h
+ * @brief Control global de los mensajes de traza del sistema
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BITACORA_H
+#define BITACORA_H
+
+#include <atomic>
+
+/**
+ * @class Bitacora
+ * @brief Interruptor de los mensajes de traza por elemento
+ * 
+ * Las listas y sensores informan en consola cada creacion, insercion y
+ * liberacion. Esto es util en modo interactivo, pero domina el costo de las
+ * operaciones masivas (cargas de instantaneas, pruebas de rendimiento), que
+ * pueden desactivar la traza y emitir un unico resumen.
+ */
+class Bitacora {
+private:
+    static std::atomic<bool>& estado() {
+        static std::atomic<bool> habilitada(true);
+        return habilitada;
+    }
+    
+public:
+    /**
+     * @brief Consulta si los mensajes de traza estan habilitados
+     * @return true si deben imprimirse los mensajes por elemento
+     */
+    static bool activa() {
+        return estado().load(std::memory_order_relaxed);
+    }
+    
+    /**
+     * @brief Habilita o deshabilita los mensajes de traza
+     * @param habilitar Nuevo estado de la bitacora
+     */
+    static void activar(bool habilitar) {
+        estado().store(habilitar, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @class SilencioBitacora
+ * @brief Desactiva la bitacora durante el alcance del objeto
+ * 
+ * Restaura el estado anterior al destruirse, incluso si el alcance
+ * termina de forma anticipada.
+ */
+class SilencioBitacora {
+private:
+    bool estadoPrevio;  ///< Estado de la bitacora antes de silenciarla
+    
+public:
+    SilencioBitacora() : estadoPrevio(Bitacora::activa()) {
+        Bitacora::activar(false);
+    }
+    
+    ~SilencioBitacora() {
+        Bitacora::activar(estadoPrevio);
+    }
+    
+private:
+    SilencioBitacora(const SilencioBitacora&);
+    SilencioBitacora& operator=(const SilencioBitacora&);
+};
+
+#endif // BITACORA_H
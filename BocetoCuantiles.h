@@ -0,0 +1,317 @@
+/**
+ * @file BocetoCuantiles.h
+ * @brief Boceto KLL para estimar percentiles con memoria acotada
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BOCETOCUANTILES_H
+#define BOCETOCUANTILES_H
+
+#include "FormatoBinario.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+/**
+ * @class BocetoCuantiles
+ * @brief Resumen de una secuencia que estima cualquier percentil
+ * 
+ * Implementa el boceto KLL (Karnin, Lang y Liberty). Las mediciones se
+ * guardan en niveles; cada elemento del nivel h representa 2^h mediciones.
+ * Cuando un nivel supera su capacidad se ordena y se promueve al nivel
+ * siguiente uno de cada dos elementos, elegidos con desplazamiento
+ * aleatorio. Las capacidades decrecen en proporcion 2/3 desde el nivel
+ * superior, de modo que el boceto conserva O(k) elementos sin importar
+ * cuantas mediciones reciba.
+ * 
+ * El parametro k regula la precision: el error de rango tipico es del
+ * orden de 1.7 / k (alrededor del 1% con k = 200).
+ * 
+ * Dos bocetos del mismo tipo se combinan nivel a nivel, por lo que los
+ * percentiles de varios sensores se obtienen sin revisar sus historiales.
+ * 
+ * @tparam T Tipo de las mediciones (debe admitir operator<)
+ */
+template <typename T>
+class BocetoCuantiles {
+public:
+    static const int K_PREDETERMINADO = 200;  ///< Precision inicial
+    static const int K_MINIMO = 8;            ///< Menor precision admitida
+    
+private:
+    int k;                                  ///< Parametro de precision
+    std::vector<std::vector<T> > niveles;   ///< Elementos retenidos por nivel
+    std::vector<std::size_t> capacidades;   ///< Capacidad de cada nivel
+    std::size_t capacidadTotal;             ///< Suma de capacidades: umbral de compactacion
+    std::size_t retenidos;                  ///< Elementos retenidos en todos los niveles
+    long long cantidad;                     ///< Mediciones resumidas
+    uint64_t azar;                          ///< Estado del generador xorshift
+    
+    /**
+     * @brief Siguiente bit pseudoaleatorio
+     * @return 0 o 1
+     */
+    int moneda() {
+        azar ^= azar << 13;
+        azar ^= azar >> 7;
+        azar ^= azar << 17;
+        return static_cast<int>(azar >> 63);
+    }
+    
+    /**
+     * @brief Ajusta un parametro de precision al minimo admitido
+     */
+    static int acotarPrecision(int precision) {
+        if (precision < K_MINIMO) {
+            return K_MINIMO;
+        }
+        return precision;
+    }
+    
+    /**
+     * @brief Recalcula las capacidades tras cambiar k o la cantidad de niveles
+     */
+    void recalcularCapacidades() {
+        const std::size_t altura = niveles.size();
+        capacidades.assign(altura, 0);
+        capacidadTotal = 0;
+        for (std::size_t h = 0; h < altura; h++) {
+            const double escala = std::pow(2.0 / 3.0, static_cast<double>(altura - h - 1));
+            capacidades[h] = static_cast<std::size_t>(std::ceil(k * escala)) + 1;
+            capacidadTotal += capacidades[h];
+        }
+    }
+    
+    /**
+     * @brief Agrega un nivel superior vacio
+     */
+    void crecer() {
+        niveles.push_back(std::vector<T>());
+        recalcularCapacidades();
+    }
+    
+    /**
+     * @brief Compacta el nivel mas bajo que excede su capacidad
+     * 
+     * Ordena el nivel y promueve uno de cada dos elementos; si la cantidad
+     * es impar, el ultimo permanece en el nivel. El peso total se conserva.
+     */
+    void compactar() {
+        for (std::size_t h = 0; h < niveles.size(); h++) {
+            if (niveles[h].size() < capacidades[h]) {
+                continue;
+            }
+            if (h + 1 == niveles.size()) {
+                crecer();
+            }
+            std::vector<T>& nivel = niveles[h];
+            std::vector<T>& superior = niveles[h + 1];
+            std::sort(nivel.begin(), nivel.end());
+            
+            const std::size_t pares = nivel.size() / 2 * 2;
+            for (std::size_t i = static_cast<std::size_t>(moneda()); i < pares; i += 2) {
+                superior.push_back(nivel[i]);
+            }
+            nivel.erase(nivel.begin(), nivel.begin() + pares);
+            retenidos -= pares / 2;
+            return;
+        }
+    }
+    
+public:
+    /**
+     * @brief Constructor
+     * @param precision Parametro k (se eleva a K_MINIMO si es menor)
+     */
+    explicit BocetoCuantiles(int precision = K_PREDETERMINADO)
+        : k(acotarPrecision(precision)), capacidadTotal(0),
+          retenidos(0), cantidad(0), azar(0x9E3779B97F4A7C15ull) {
+        crecer();
+    }
+    
+    /**
+     * @brief Incorpora una medicion
+     * @param valor Medicion a resumir
+     * 
+     * Costo amortizado O(log k): cada compactacion ordena un nivel que
+     * tardo del orden de k inserciones en llenarse.
+     */
+    void agregar(T valor) {
+        niveles[0].push_back(valor);
+        retenidos++;
+        cantidad++;
+        if (retenidos >= capacidadTotal) {
+            compactar();
+        }
+    }
+    
+    /**
+     * @brief Incorpora un arreglo de mediciones
+     * @param valores Mediciones a resumir
+     * @param total Numero de mediciones
+     * 
+     * Copia en el nivel inferior tramos que llegan justo al umbral de
+     * compactacion, de modo que el boceto resultante es el mismo que con
+     * agregar() aplicado a cada medicion.
+     */
+    void agregarBloque(const T* valores, std::size_t total) {
+        std::size_t copiados = 0;
+        while (copiados < total) {
+            std::size_t tramo = 1;
+            if (retenidos < capacidadTotal) {
+                tramo = std::min(total - copiados, capacidadTotal - retenidos);
+            }
+            niveles[0].insert(niveles[0].end(), valores + copiados, valores + copiados + tramo);
+            retenidos += tramo;
+            cantidad += static_cast<long long>(tramo);
+            copiados += tramo;
+            if (retenidos >= capacidadTotal) {
+                compactar();
+            }
+        }
+    }
+    
+    /**
+     * @brief Incorpora todas las mediciones resumidas por otro boceto
+     * @param otro Boceto a combinar (puede tener otra precision)
+     */
+    void combinar(const BocetoCuantiles& otro) {
+        while (niveles.size() < otro.niveles.size()) {
+            crecer();
+        }
+        for (std::size_t h = 0; h < otro.niveles.size(); h++) {
+            niveles[h].insert(niveles[h].end(), otro.niveles[h].begin(), otro.niveles[h].end());
+        }
+        retenidos += otro.retenidos;
+        cantidad += otro.cantidad;
+        while (retenidos >= capacidadTotal) {
+            compactar();
+        }
+    }
+    
+    /**
+     * @brief Estima el valor de un cuantil
+     * @param q Fraccion acumulada buscada (0.5 mediana, 0.99 percentil 99)
+     * @return Elemento retenido cuyo rango acumulado alcanza q; T() si el boceto esta vacio
+     */
+    T cuantil(double q) const {
+        if (cantidad == 0) {
+            return T();
+        }
+        std::vector<std::pair<T, long long> > ponderados;
+        ponderados.reserve(retenidos);
+        for (std::size_t h = 0; h < niveles.size(); h++) {
+            for (std::size_t i = 0; i < niveles[h].size(); i++) {
+                ponderados.push_back(std::make_pair(niveles[h][i], 1LL << h));
+            }
+        }
+        std::sort(ponderados.begin(), ponderados.end());
+        
+        const double objetivo = (q < 0.0 ? 0.0 : (q > 1.0 ? 1.0 : q)) * static_cast<double>(cantidad);
+        long long acumulado = 0;
+        for (std::size_t i = 0; i < ponderados.size(); i++) {
+            acumulado += ponderados[i].second;
+            if (static_cast<double>(acumulado) >= objetivo) {
+                return ponderados[i].first;
+            }
+        }
+        return ponderados.back().first;
+    }
+    
+    /**
+     * @brief Cambia la precision conservando las mediciones ya resumidas
+     * @param precision Nuevo parametro k (se eleva a K_MINIMO si es menor)
+     */
+    void setPrecision(int precision) {
+        k = acotarPrecision(precision);
+        recalcularCapacidades();
+        while (retenidos >= capacidadTotal) {
+            compactar();
+        }
+    }
+    
+    /**
+     * @brief Descarta todas las mediciones resumidas
+     */
+    void vaciar() {
+        niveles.assign(1, std::vector<T>());
+        recalcularCapacidades();
+        retenidos = 0;
+        cantidad = 0;
+    }
+    
+    int getPrecision() const { return k; }
+    long long getCantidad() const { return cantidad; }
+    bool estaVacio() const { return cantidad == 0; }
+    std::size_t getRetenidos() const { return retenidos; }
+    
+    /**
+     * @brief Memoria ocupada por el boceto
+     * @return Bytes reservados por los niveles
+     */
+    std::size_t bytesOcupados() const {
+        std::size_t total = sizeof(BocetoCuantiles) + niveles.capacity() * sizeof(std::vector<T>) +
+                            capacidades.capacity() * sizeof(std::size_t);
+        for (std::size_t h = 0; h < niveles.size(); h++) {
+            total += niveles[h].capacity() * sizeof(T);
+        }
+        return total;
+    }
+    
+    /**
+     * @brief Escribe el boceto completo
+     * @param salida Flujo binario de destino
+     */
+    void guardar(std::ostream& salida) const {
+        const int32_t precision = k;
+        const uint32_t altura = static_cast<uint32_t>(niveles.size());
+        escribirBinario(salida, precision);
+        escribirBinario(salida, cantidad);
+        escribirBinario(salida, azar);
+        escribirBinario(salida, altura);
+        for (std::size_t h = 0; h < niveles.size(); h++) {
+            escribirVectorBinario(salida, niveles[h]);
+        }
+    }
+    
+    /**
+     * @brief Reemplaza el boceto por uno escrito con guardar()
+     * @param entrada Flujo binario de origen
+     * @return true si la lectura fue completa y coherente
+     */
+    bool cargar(std::istream& entrada) {
+        int32_t precision = 0;
+        uint32_t altura = 0;
+        if (!leerBinario(entrada, precision) || !leerBinario(entrada, cantidad) ||
+            !leerBinario(entrada, azar) || !leerBinario(entrada, altura) || altura == 0 || altura > 62) {
+            vaciar();
+            return false;
+        }
+        k = acotarPrecision(precision);
+        niveles.assign(altura, std::vector<T>());
+        retenidos = 0;
+        long long peso = 0;
+        for (std::size_t h = 0; h < niveles.size(); h++) {
+            if (!leerVectorBinario(entrada, niveles[h])) {
+                vaciar();
+                return false;
+            }
+            retenidos += niveles[h].size();
+            peso += static_cast<long long>(niveles[h].size()) << h;
+        }
+        recalcularCapacidades();
+        if (peso != cantidad) {
+            vaciar();
+            return false;
+        }
+        return true;
+    }
+};
+
+#endif // BOCETOCUANTILES_H
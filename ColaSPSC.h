@@ -0,0 +1,109 @@
+/**
+ * @file ColaSPSC.h
+ * @brief Cola circular sin bloqueos para un productor y un consumidor
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef COLASPSC_H
+#define COLASPSC_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class ColaSPSC
+ * @brief Cola acotada entre exactamente un hilo productor y un hilo consumidor
+ * 
+ * El productor solo escribe la posicion final y el consumidor solo la
+ * inicial, de modo que ninguna operacion necesita cerrojos: basta un par
+ * de lecturas y escrituras atomicas con orden adquisicion/liberacion.
+ * Ambas posiciones ocupan lineas de cache distintas para que los dos
+ * hilos no se disputen la misma linea.
+ * 
+ * Si la cola esta llena, el elemento se descarta y se contabiliza; el
+ * productor nunca espera al consumidor.
+ * 
+ * @tparam T Tipo de los elementos (copiable)
+ */
+template <typename T>
+class ColaSPSC {
+private:
+    static const std::size_t LINEA_CACHE = 64;  ///< Tamanio de linea de cache supuesto
+    
+    std::vector<T> elementos;  ///< Almacenamiento circular
+    std::size_t mascara;       ///< Capacidad - 1 (la capacidad es potencia de dos)
+    
+    alignas(LINEA_CACHE) std::atomic<std::size_t> inicio;        ///< Proxima posicion a leer (consumidor)
+    alignas(LINEA_CACHE) std::atomic<std::size_t> fin;           ///< Proxima posicion a escribir (productor)
+    alignas(LINEA_CACHE) std::atomic<unsigned long long> descartados;  ///< Elementos perdidos por cola llena
+    
+public:
+    /**
+     * @brief Constructor
+     * @param capacidadMinima Elementos que debe admitir (se redondea a potencia de dos)
+     */
+    explicit ColaSPSC(std::size_t capacidadMinima = 1024)
+        : mascara(0), inicio(0), fin(0), descartados(0) {
+        std::size_t capacidad = 2;
+        while (capacidad < capacidadMinima) {
+            capacidad <<= 1;
+        }
+        elementos.resize(capacidad);
+        mascara = capacidad - 1;
+    }
+    
+    /**
+     * @brief Agrega un elemento (solo desde el hilo productor)
+     * @param elemento Valor a encolar
+     * @return true si se encolo, false si la cola estaba llena y se descarto
+     */
+    bool intentarEncolar(const T& elemento) {
+        const std::size_t posicion = fin.load(std::memory_order_relaxed);
+        if (posicion - inicio.load(std::memory_order_acquire) > mascara) {
+            descartados.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        elementos[posicion & mascara] = elemento;
+        fin.store(posicion + 1, std::memory_order_release);
+        return true;
+    }
+    
+    /**
+     * @brief Extrae el elemento mas antiguo (solo desde el hilo consumidor)
+     * @param elemento Destino del valor extraido
+     * @return true si habia un elemento, false si la cola estaba vacia
+     */
+    bool intentarDesencolar(T& elemento) {
+        const std::size_t posicion = inicio.load(std::memory_order_relaxed);
+        if (posicion == fin.load(std::memory_order_acquire)) {
+            return false;
+        }
+        elemento = elementos[posicion & mascara];
+        inicio.store(posicion + 1, std::memory_order_release);
+        return true;
+    }
+    
+    /**
+     * @brief Elementos descartados por cola llena desde la creacion
+     */
+    unsigned long long getDescartados() const {
+        return descartados.load(std::memory_order_relaxed);
+    }
+    
+    /**
+     * @brief Elementos pendientes de desencolar
+     * @return Ocupacion aproximada; puede consultarse desde cualquier hilo
+     */
+    std::size_t getOcupacion() const {
+        const std::size_t primero = inicio.load(std::memory_order_acquire);
+        const std::size_t ultimo = fin.load(std::memory_order_acquire);
+        return ultimo >= primero ? ultimo - primero : 0;
+    }
+    
+    std::size_t getCapacidad() const { return mascara + 1; }
+};
+
+#endif // COLASPSC_H
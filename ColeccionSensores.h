@@ -0,0 +1,18 @@
+/**
+ * @file ColeccionSensores.h
+ * @brief Definicion de la lista polimorfica de sensores del sistema
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef COLECCIONSENSORES_H
+#define COLECCIONSENSORES_H
+
+#include "SensorBase.h"
+#include "ListaSensor.h"
+
+/// Definicion de tipo para lista polimorfica de sensores
+typedef ListaSensor<SensorBase*> ColeccionSensores;
+
+#endif // COLECCIONSENSORES_H
@@ -0,0 +1,90 @@
+/**
+ * @file FormatoBinario.h
+ * @brief Funciones auxiliares para lectura y escritura binaria de valores simples
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef FORMATOBINARIO_H
+#define FORMATOBINARIO_H
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief Escribe un valor en su representacion de memoria
+ * @tparam V Tipo simple (entero, flotante o estructura sin punteros)
+ * @param salida Flujo binario de destino
+ * @param valor Valor a escribir
+ */
+template <typename V>
+void escribirBinario(std::ostream& salida, const V& valor) {
+    salida.write(reinterpret_cast<const char*>(&valor), sizeof(V));
+}
+
+/**
+ * @brief Lee un valor escrito con escribirBinario
+ * @tparam V Tipo simple (entero, flotante o estructura sin punteros)
+ * @param entrada Flujo binario de origen
+ * @param valor Variable que recibe el valor leido
+ * @return true si la lectura fue completa, false en caso contrario
+ */
+template <typename V>
+bool leerBinario(std::istream& entrada, V& valor) {
+    return static_cast<bool>(entrada.read(reinterpret_cast<char*>(&valor), sizeof(V)));
+}
+
+/**
+ * @brief Escribe un vector precedido de su cantidad de elementos (64 bits)
+ * @param salida Flujo binario de destino
+ * @param valores Vector a escribir
+ */
+template <typename V>
+void escribirVectorBinario(std::ostream& salida, const std::vector<V>& valores) {
+    const uint64_t cantidad = static_cast<uint64_t>(valores.size());
+    escribirBinario(salida, cantidad);
+    if (cantidad > 0) {
+        salida.write(reinterpret_cast<const char*>(valores.data()), valores.size() * sizeof(V));
+    }
+}
+
+/**
+ * @brief Lee un vector escrito con escribirVectorBinario
+ * @param entrada Flujo binario de origen
+ * @param valores Vector que recibe los elementos (se reemplaza su contenido)
+ * @param limite Cantidad maxima aceptada, para rechazar archivos danados
+ * @return true si la lectura fue completa, false en caso contrario
+ * 
+ * El vector crece por tramos de 64 KB a medida que llegan los datos: una
+ * cantidad danada en un flujo truncado falla al agotarse el flujo, sin
+ * reservar de antemano la memoria que anuncia.
+ */
+template <typename V>
+bool leerVectorBinario(std::istream& entrada, std::vector<V>& valores, uint64_t limite = UINT32_MAX) {
+    uint64_t cantidad = 0;
+    valores.clear();
+    if (!leerBinario(entrada, cantidad) || cantidad > limite) {
+        return false;
+    }
+    const uint64_t porTramo = sizeof(V) < 65536 ? 65536 / sizeof(V) : 1;
+    uint64_t leidos = 0;
+    while (leidos < cantidad) {
+        const std::size_t tramo = static_cast<std::size_t>(std::min(cantidad - leidos, porTramo));
+        valores.resize(valores.size() + tramo);
+        if (!entrada.read(reinterpret_cast<char*>(valores.data() + leidos), tramo * sizeof(V))) {
+            valores.clear();
+            return false;
+        }
+        leidos += tramo;
+    }
+    if (valores.capacity() > valores.size()) {
+        valores.shrink_to_fit();
+    }
+    return true;
+}
+
+#endif // FORMATOBINARIO_H
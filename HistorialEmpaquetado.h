@@ -0,0 +1,434 @@
+/**
+ * @file HistorialEmpaquetado.h
+ * @brief Historial comprimido de mediciones enteras (delta + empaquetado de bits)
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef HISTORIALEMPAQUETADO_H
+#define HISTORIALEMPAQUETADO_H
+
+#include "FormatoBinario.h"
+#include "RelojMonotonico.h"
+#include "ResumenRango.h"
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <vector>
+
+/**
+ * @class HistorialEmpaquetado
+ * @brief Secuencia de bloques de 128 enteros codificados por diferencias
+ * 
+ * Cada bloque guarda su primer valor y las diferencias entre valores
+ * consecutivos en codificacion zigzag. A las diferencias se les resta la
+ * menor de ellas (marco de referencia) y se empaquetan con el ancho de
+ * bits justo para la mayor.
+ * 
+ * El empaquetado es vertical en cuatro carriles: el valor i pertenece al
+ * carril i % 4 y los carriles avanzan juntos con los mismos desplazamientos,
+ * de modo que el desempaquetado opera sobre grupos de cuatro palabras de
+ * 32 bits que el compilador traduce a instrucciones vectoriales.
+ * 
+ * La cabecera de cada bloque conserva la suma, el minimo y el maximo de
+ * sus valores, por lo que la media del historial se obtiene sin
+ * desempaquetar ningun bloque.
+ * 
+ * Cada valor lleva su marca de tiempo. Las marcas de un bloque se guardan
+ * como diferencias entre marcas consecutivas, con el mismo marco de
+ * referencia y empaquetado que los valores; la cabecera conserva la
+ * primera y la ultima marca para localizar bloques por busqueda binaria.
+ * Las marcas deben ser no decrecientes.
+ */
+class HistorialEmpaquetado {
+public:
+    static const int TAMANIO_BLOQUE = 128;  ///< Valores por bloque
+    static const int CARRILES = 4;          ///< Carriles del empaquetado vertical
+    
+private:
+    /// Cabecera de un bloque empaquetado
+    struct Descriptor {
+        int64_t suma;                  ///< Suma de los valores del bloque
+        int64_t inicio;                ///< Marca de tiempo del primer valor
+        int64_t fin;                   ///< Marca de tiempo del ultimo valor
+        int32_t base;                  ///< Primer valor del bloque
+        int32_t minimo;                ///< Menor valor del bloque
+        int32_t maximo;                ///< Mayor valor del bloque
+        uint32_t referencia;           ///< Menor diferencia zigzag del bloque
+        uint32_t desplazamiento;       ///< Posicion de los valores en el arreglo de palabras
+        uint32_t referenciaMarcas;     ///< Menor diferencia entre marcas del bloque
+        uint32_t desplazamientoMarcas; ///< Posicion de las marcas en el arreglo de palabras
+        uint8_t ancho;                 ///< Bits por diferencia de valor (0 a 32)
+        uint8_t anchoMarcas;           ///< Bits por diferencia de marca (0 a 32)
+        uint8_t cantidad;              ///< Valores del bloque (1 a 128)
+        uint8_t relleno;               ///< Alineacion explicita para la serializacion
+    };
+    
+    std::vector<Descriptor> bloques;  ///< Cabeceras en orden cronologico
+    std::vector<uint32_t> palabras;   ///< Bits empaquetados de todos los bloques
+    long long cantidad;               ///< Valores totales del historial
+    
+    static uint32_t zigzag(uint32_t diferencia) {
+        return (diferencia << 1) ^ (0u - (diferencia >> 31));
+    }
+    
+    static uint32_t deshacerZigzag(uint32_t codigo) {
+        return (codigo >> 1) ^ (0u - (codigo & 1u));
+    }
+    
+    static uint32_t mascara(int ancho) {
+        return ancho == 32 ? 0xFFFFFFFFu : ((1u << ancho) - 1u);
+    }
+    
+    /**
+     * @brief Empaqueta 128 enteros sin signo con un ancho fijo
+     * @param entrada Valores a empaquetar (menores que 2^ancho)
+     * @param ancho Bits por valor (1 a 32)
+     * @param salida Destino de CARRILES * ancho palabras, inicializadas en cero
+     */
+    static void empaquetar(const uint32_t* entrada, int ancho, uint32_t* salida) {
+        for (int fila = 0; fila < TAMANIO_BLOQUE / CARRILES; fila++) {
+            const int bit = fila * ancho;
+            const int palabra = bit / 32;
+            const int desplazamiento = bit % 32;
+            for (int carril = 0; carril < CARRILES; carril++) {
+                const uint32_t valor = entrada[fila * CARRILES + carril];
+                salida[palabra * CARRILES + carril] |= valor << desplazamiento;
+                if (desplazamiento + ancho > 32) {
+                    salida[(palabra + 1) * CARRILES + carril] |= valor >> (32 - desplazamiento);
+                }
+            }
+        }
+    }
+    
+    /**
+     * @brief Desempaqueta 128 enteros sin signo de ancho fijo
+     * @param entrada Palabras producidas por empaquetar()
+     * @param ancho Bits por valor (0 a 32)
+     * @param salida Destino de 128 valores
+     * 
+     * El ciclo interno sobre los carriles no tiene dependencias entre
+     * iteraciones y se vectoriza en grupos de cuatro palabras.
+     */
+    static void desempaquetar(const uint32_t* entrada, int ancho, uint32_t* salida) {
+        if (ancho == 0) {
+            for (int i = 0; i < TAMANIO_BLOQUE; i++) {
+                salida[i] = 0;
+            }
+            return;
+        }
+        const uint32_t filtro = mascara(ancho);
+        for (int fila = 0; fila < TAMANIO_BLOQUE / CARRILES; fila++) {
+            const int bit = fila * ancho;
+            const int palabra = bit / 32;
+            const int desplazamiento = bit % 32;
+            const uint32_t* actual = entrada + palabra * CARRILES;
+            uint32_t* destino = salida + fila * CARRILES;
+            if (desplazamiento + ancho > 32) {
+                const uint32_t* proxima = actual + CARRILES;
+                for (int carril = 0; carril < CARRILES; carril++) {
+                    destino[carril] = ((actual[carril] >> desplazamiento) |
+                                       (proxima[carril] << (32 - desplazamiento))) & filtro;
+                }
+            } else {
+                for (int carril = 0; carril < CARRILES; carril++) {
+                    destino[carril] = (actual[carril] >> desplazamiento) & filtro;
+                }
+            }
+        }
+    }
+    
+    /**
+     * @brief Resta el marco de referencia y empaqueta las diferencias de un bloque
+     * @param diferencias Diferencias en las posiciones 1 a total - 1 (se modifican)
+     * @param total Valores del bloque
+     * @param referencia Destino de la menor diferencia
+     * @param ancho Destino de los bits por diferencia
+     * @return Posicion de las palabras empaquetadas en el arreglo compartido
+     */
+    uint32_t empaquetarDiferencias(uint32_t* diferencias, int total, uint32_t& referencia, uint8_t& ancho) {
+        uint32_t menor = 0xFFFFFFFFu;
+        for (int i = 1; i < total; i++) {
+            if (diferencias[i] < menor) {
+                menor = diferencias[i];
+            }
+        }
+        referencia = total > 1 ? menor : 0;
+        
+        uint32_t mayor = 0;
+        for (int i = 1; i < total; i++) {
+            diferencias[i] -= referencia;
+            if (diferencias[i] > mayor) {
+                mayor = diferencias[i];
+            }
+        }
+        ancho = static_cast<uint8_t>(mayor == 0 ? 0 : 32 - __builtin_clz(mayor));
+        
+        const uint32_t desplazamiento = static_cast<uint32_t>(palabras.size());
+        if (ancho > 0) {
+            palabras.resize(palabras.size() + CARRILES * ancho, 0);
+            empaquetar(diferencias, ancho, palabras.data() + desplazamiento);
+        }
+        return desplazamiento;
+    }
+    
+    /**
+     * @brief Reconstruye los valores de un bloque
+     * @param indice Posicion del bloque
+     * @param valores Destino de al menos TAMANIO_BLOQUE enteros
+     */
+    void decodificarBloque(std::size_t indice, int32_t* valores) const {
+        const Descriptor& bloque = bloques[indice];
+        uint32_t diferencias[TAMANIO_BLOQUE];
+        desempaquetar(palabras.data() + bloque.desplazamiento, bloque.ancho, diferencias);
+        
+        uint32_t actual = static_cast<uint32_t>(bloque.base);
+        valores[0] = bloque.base;
+        for (int i = 1; i < bloque.cantidad; i++) {
+            actual += deshacerZigzag(diferencias[i] + bloque.referencia);
+            valores[i] = static_cast<int32_t>(actual);
+        }
+    }
+    
+    /**
+     * @brief Reconstruye las marcas de tiempo de un bloque
+     * @param indice Posicion del bloque
+     * @param marcas Destino de al menos TAMANIO_BLOQUE marcas
+     */
+    void decodificarMarcas(std::size_t indice, MarcaTiempo* marcas) const {
+        const Descriptor& bloque = bloques[indice];
+        uint32_t diferencias[TAMANIO_BLOQUE];
+        desempaquetar(palabras.data() + bloque.desplazamientoMarcas, bloque.anchoMarcas, diferencias);
+        
+        marcas[0] = bloque.inicio;
+        for (int i = 1; i < bloque.cantidad; i++) {
+            marcas[i] = marcas[i - 1] + (diferencias[i] + bloque.referenciaMarcas);
+        }
+    }
+    
+public:
+    /**
+     * @brief Constructor de historial vacio
+     */
+    HistorialEmpaquetado() : cantidad(0) {}
+    
+    /**
+     * @brief Codifica un bloque de valores al final del historial
+     * @param valores Arreglo de origen
+     * @param marcas Marcas de tiempo de cada valor, no decrecientes
+     * @param total Numero de valores (1 a TAMANIO_BLOQUE)
+     * 
+     * Si dos marcas consecutivas distan 2^32 ms o mas, el bloque se divide
+     * en ese punto para que las diferencias de marca quepan en 32 bits.
+     */
+    void agregarBloque(const int32_t* valores, const MarcaTiempo* marcas, int total) {
+        if (total <= 0 || total > TAMANIO_BLOQUE) {
+            return;
+        }
+        for (int i = 1; i < total; i++) {
+            if (marcas[i] - marcas[i - 1] > static_cast<MarcaTiempo>(0xFFFFFFFFu)) {
+                agregarBloque(valores, marcas, i);
+                agregarBloque(valores + i, marcas + i, total - i);
+                return;
+            }
+        }
+        
+        Descriptor bloque;
+        bloque.base = valores[0];
+        bloque.cantidad = static_cast<uint8_t>(total);
+        bloque.relleno = 0;
+        bloque.suma = valores[0];
+        bloque.minimo = valores[0];
+        bloque.maximo = valores[0];
+        bloque.inicio = marcas[0];
+        bloque.fin = marcas[total - 1];
+        
+        // Diferencias en aritmetica modular de 32 bits: nunca desbordan
+        uint32_t diferencias[TAMANIO_BLOQUE] = { 0 };
+        for (int i = 1; i < total; i++) {
+            diferencias[i] = zigzag(static_cast<uint32_t>(valores[i]) - static_cast<uint32_t>(valores[i - 1]));
+            bloque.suma += valores[i];
+            bloque.minimo = std::min(bloque.minimo, valores[i]);
+            bloque.maximo = std::max(bloque.maximo, valores[i]);
+        }
+        bloque.desplazamiento = empaquetarDiferencias(diferencias, total, bloque.referencia, bloque.ancho);
+        
+        uint32_t diferenciasMarcas[TAMANIO_BLOQUE] = { 0 };
+        for (int i = 1; i < total; i++) {
+            diferenciasMarcas[i] = static_cast<uint32_t>(marcas[i] - marcas[i - 1]);
+        }
+        bloque.desplazamientoMarcas = empaquetarDiferencias(diferenciasMarcas, total, bloque.referenciaMarcas,
+                                                            bloque.anchoMarcas);
+        
+        bloques.push_back(bloque);
+        cantidad += total;
+    }
+    
+    /**
+     * @brief Decodifica todo el historial bloque por bloque
+     * @tparam Operacion Funcion invocada como operacion(valor)
+     * @param operacion Funcion que se aplicara a cada valor en orden
+     */
+    template <typename Operacion>
+    void iterar(Operacion operacion) const {
+        int32_t valores[TAMANIO_BLOQUE];
+        for (std::size_t b = 0; b < bloques.size(); b++) {
+            decodificarBloque(b, valores);
+            for (int i = 0; i < bloques[b].cantidad; i++) {
+                operacion(static_cast<int>(valores[i]));
+            }
+        }
+    }
+    
+    /**
+     * @brief Decodifica todo el historial junto con las marcas de tiempo
+     * @tparam Operacion Funcion invocada como operacion(marca, valor)
+     * @param operacion Funcion que se aplicara a cada par en orden
+     */
+    template <typename Operacion>
+    void iterarConMarcas(Operacion operacion) const {
+        int32_t valores[TAMANIO_BLOQUE];
+        MarcaTiempo marcas[TAMANIO_BLOQUE];
+        for (std::size_t b = 0; b < bloques.size(); b++) {
+            decodificarBloque(b, valores);
+            decodificarMarcas(b, marcas);
+            for (int i = 0; i < bloques[b].cantidad; i++) {
+                operacion(marcas[i], static_cast<int>(valores[i]));
+            }
+        }
+    }
+    
+    /**
+     * @brief Acumula los valores con marca en [desde, hasta)
+     * @param desde Inicio del intervalo (incluido)
+     * @param hasta Fin del intervalo (excluido)
+     * @param resumen Agregados donde se incorporan los valores
+     * 
+     * Localiza el primer bloque por busqueda binaria sobre las marcas
+     * finales. Los bloques contenidos por completo en el intervalo aportan
+     * los agregados de su cabecera; solo los de los extremos se desempaquetan.
+     */
+    void acumularRango(MarcaTiempo desde, MarcaTiempo hasta, ResumenRango& resumen) const {
+        std::vector<Descriptor>::const_iterator bloque = std::lower_bound(
+            bloques.begin(), bloques.end(), desde,
+            [](const Descriptor& actual, MarcaTiempo marca) { return actual.fin < marca; });
+        
+        int32_t valores[TAMANIO_BLOQUE];
+        MarcaTiempo marcas[TAMANIO_BLOQUE];
+        for (; bloque != bloques.end() && bloque->inicio < hasta; ++bloque) {
+            if (desde <= bloque->inicio && bloque->fin < hasta) {
+                ResumenRango parcial;
+                parcial.cantidad = bloque->cantidad;
+                parcial.minimo = bloque->minimo;
+                parcial.maximo = bloque->maximo;
+                parcial.suma = static_cast<double>(bloque->suma);
+                resumen.combinar(parcial);
+                continue;
+            }
+            const std::size_t indice = static_cast<std::size_t>(bloque - bloques.begin());
+            decodificarBloque(indice, valores);
+            decodificarMarcas(indice, marcas);
+            for (int i = 0; i < bloque->cantidad; i++) {
+                if (marcas[i] >= desde && marcas[i] < hasta) {
+                    resumen.incorporar(valores[i]);
+                }
+            }
+        }
+    }
+    
+    /**
+     * @brief Suma de todos los valores del historial
+     * @return Suma exacta en 64 bits, obtenida de las cabeceras de bloque
+     */
+    long long sumar() const {
+        long long total = 0;
+        for (std::size_t b = 0; b < bloques.size(); b++) {
+            total += bloques[b].suma;
+        }
+        return total;
+    }
+    
+    /**
+     * @brief Elimina todos los valores del historial
+     */
+    void vaciar() {
+        std::vector<Descriptor>().swap(bloques);
+        std::vector<uint32_t>().swap(palabras);
+        cantidad = 0;
+    }
+    
+    /**
+     * @brief Traslada todas las marcas del historial
+     * @param desplazamiento Milisegundos a sumar a cada marca
+     * 
+     * Dentro de cada bloque las marcas son diferencias; basta con mover
+     * la primera y la ultima de cada descriptor.
+     */
+    void desplazarMarcas(MarcaTiempo desplazamiento) {
+        for (std::size_t b = 0; b < bloques.size(); b++) {
+            bloques[b].inicio += desplazamiento;
+            bloques[b].fin += desplazamiento;
+        }
+    }
+    
+    long long getCantidad() const { return cantidad; }
+    bool estaVacio() const { return cantidad == 0; }
+    int getCantidadBloques() const { return static_cast<int>(bloques.size()); }
+    
+    /**
+     * @brief Marca de tiempo de la ultima medicion del historial
+     * @return Ultima marca, o la menor marca representable si esta vacio
+     */
+    MarcaTiempo getUltimaMarca() const {
+        return bloques.empty() ? std::numeric_limits<MarcaTiempo>::min() : bloques.back().fin;
+    }
+    
+    /**
+     * @brief Memoria ocupada por el historial comprimido
+     * @return Bytes del objeto, las cabeceras y las palabras empaquetadas
+     */
+    std::size_t bytesOcupados() const {
+        return sizeof(HistorialEmpaquetado) + bloques.capacity() * sizeof(Descriptor) +
+               palabras.capacity() * sizeof(uint32_t);
+    }
+    
+    /**
+     * @brief Escribe el historial completo
+     * @param salida Flujo binario de destino
+     */
+    void guardar(std::ostream& salida) const {
+        escribirVectorBinario(salida, bloques);
+        escribirVectorBinario(salida, palabras);
+    }
+    
+    /**
+     * @brief Reemplaza el historial por uno escrito con guardar()
+     * @param entrada Flujo binario de origen
+     * @return true si la lectura fue completa y coherente
+     */
+    bool cargar(std::istream& entrada) {
+        vaciar();
+        if (!leerVectorBinario(entrada, bloques) || !leerVectorBinario(entrada, palabras)) {
+            vaciar();
+            return false;
+        }
+        for (std::size_t b = 0; b < bloques.size(); b++) {
+            const Descriptor& bloque = bloques[b];
+            if (bloque.cantidad == 0 || bloque.cantidad > TAMANIO_BLOQUE || bloque.ancho > 32 ||
+                bloque.anchoMarcas > 32 || bloque.fin < bloque.inicio ||
+                static_cast<std::size_t>(bloque.desplazamiento) + CARRILES * bloque.ancho > palabras.size() ||
+                static_cast<std::size_t>(bloque.desplazamientoMarcas) + CARRILES * bloque.anchoMarcas >
+                    palabras.size()) {
+                vaciar();
+                return false;
+            }
+            cantidad += bloque.cantidad;
+        }
+        return true;
+    }
+};
+
+#endif // HISTORIALEMPAQUETADO_H
@@ -0,0 +1,537 @@
+/**
+ * @file HistorialGorilla.h
+ * @brief Historial comprimido de mediciones flotantes (codificacion tipo Gorilla)
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef HISTORIALGORILLA_H
+#define HISTORIALGORILLA_H
+
+#include "RelojMonotonico.h"
+#include "FormatoBinario.h"
+#include "ResumenRango.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+/**
+ * @class LectorBits
+ * @brief Lectura secuencial de campos de bits de longitud variable
+ * 
+ * Los bits se consumen del mas significativo al menos significativo
+ * de cada palabra de 64 bits.
+ */
+class LectorBits {
+private:
+    const std::vector<uint64_t>& palabras;  ///< Secuencia de origen
+    uint64_t posicion;                      ///< Proximo bit a leer
+    
+public:
+    explicit LectorBits(const std::vector<uint64_t>& origen) : palabras(origen), posicion(0) {}
+    
+    /**
+     * @brief Lee un campo de bits
+     * @param cantidad Numero de bits del campo (1 a 64)
+     * @return Valor del campo alineado a la derecha
+     */
+    uint64_t leer(int cantidad) {
+        const std::size_t indice = static_cast<std::size_t>(posicion / 64);
+        const int desplazamiento = static_cast<int>(posicion % 64);
+        const int disponibles = 64 - desplazamiento;
+        uint64_t resultado;
+        
+        if (cantidad <= disponibles) {
+            resultado = (palabras[indice] << desplazamiento) >> (64 - cantidad);
+        } else {
+            const int resto = cantidad - disponibles;
+            const uint64_t alto = (palabras[indice] << desplazamiento) >> desplazamiento;
+            resultado = (alto << resto) | (palabras[indice + 1] >> (64 - resto));
+        }
+        posicion += static_cast<uint64_t>(cantidad);
+        return resultado;
+    }
+    
+    /**
+     * @brief Lee un unico bit
+     * @return true si el bit vale 1
+     */
+    bool leerBit() {
+        return leer(1) != 0;
+    }
+};
+
+/**
+ * @class BloqueGorilla
+ * @brief Bloque de mediciones (marca de tiempo, valor flotante) comprimido
+ * 
+ * Sigue el esquema de Gorilla (Facebook, 2015):
+ * - Marcas de tiempo: delta de deltas con prefijos de longitud variable
+ *   ('0' si el intervalo no cambia, luego 7, 9, 12 o 64 bits).
+ * - Valores: XOR con el valor anterior; '0' si es identico, y en otro caso
+ *   solo los bits significativos, reutilizando la ventana de ceros del
+ *   valor anterior cuando es posible.
+ * 
+ * Admite agregado en flujo y decodificacion en flujo sin descomprimir
+ * el bloque completo en memoria.
+ */
+class BloqueGorilla {
+private:
+    std::vector<uint64_t> palabras;  ///< Bits codificados
+    uint64_t bitsEscritos;           ///< Longitud del flujo en bits
+    int cantidad;                    ///< Mediciones codificadas
+    MarcaTiempo inicio;              ///< Marca de la primera medicion
+    MarcaTiempo ultimaMarca;         ///< Marca de la ultima medicion
+    int64_t ultimoDelta;             ///< Intervalo entre las dos ultimas marcas
+    uint32_t ultimoValor;            ///< Bits del ultimo valor codificado
+    int cerosIniciales;              ///< Ventana vigente: ceros a la izquierda
+    int cerosFinales;                ///< Ventana vigente: ceros a la derecha
+    float minimo;                    ///< Menor valor del bloque
+    float maximo;                    ///< Mayor valor del bloque
+    double suma;                     ///< Suma de los valores del bloque
+    
+    /// Valor de cerosIniciales que indica que aun no hay ventana vigente
+    static const int SIN_VENTANA = 33;
+    
+    void escribirBits(uint64_t valor, int longitud) {
+        if (longitud < 64) {
+            valor &= (static_cast<uint64_t>(1) << longitud) - 1;
+        }
+        const int usados = static_cast<int>(bitsEscritos % 64);
+        if (usados == 0) {
+            palabras.push_back(0);
+        }
+        const int libres = 64 - usados;
+        if (longitud <= libres) {
+            palabras.back() |= valor << (libres - longitud);
+        } else {
+            const int resto = longitud - libres;
+            palabras.back() |= valor >> resto;
+            palabras.push_back(valor << (64 - resto));
+        }
+        bitsEscritos += static_cast<uint64_t>(longitud);
+    }
+    
+    void escribirBit(bool bit) {
+        escribirBits(bit ? 1 : 0, 1);
+    }
+    
+    static uint32_t bitsDe(float valor) {
+        uint32_t bits;
+        std::memcpy(&bits, &valor, sizeof(bits));
+        return bits;
+    }
+    
+    static float valorDe(uint32_t bits) {
+        float valor;
+        std::memcpy(&valor, &bits, sizeof(valor));
+        return valor;
+    }
+    
+    static int64_t extenderSigno(uint64_t valor, int longitud) {
+        const uint64_t signo = static_cast<uint64_t>(1) << (longitud - 1);
+        return static_cast<int64_t>((valor ^ signo) - signo);
+    }
+    
+    void codificarMarca(MarcaTiempo marca) {
+        const int64_t delta = marca - ultimaMarca;
+        const int64_t deltaDeDelta = delta - ultimoDelta;
+        
+        if (deltaDeDelta == 0) {
+            escribirBit(false);
+        } else if (deltaDeDelta >= -64 && deltaDeDelta <= 63) {
+            escribirBits(0x2, 2);
+            escribirBits(static_cast<uint64_t>(deltaDeDelta), 7);
+        } else if (deltaDeDelta >= -256 && deltaDeDelta <= 255) {
+            escribirBits(0x6, 3);
+            escribirBits(static_cast<uint64_t>(deltaDeDelta), 9);
+        } else if (deltaDeDelta >= -2048 && deltaDeDelta <= 2047) {
+            escribirBits(0xE, 4);
+            escribirBits(static_cast<uint64_t>(deltaDeDelta), 12);
+        } else {
+            escribirBits(0xF, 4);
+            escribirBits(static_cast<uint64_t>(deltaDeDelta), 64);
+        }
+        ultimoDelta = delta;
+        ultimaMarca = marca;
+    }
+    
+    void codificarValor(uint32_t bits) {
+        const uint32_t diferencia = bits ^ ultimoValor;
+        ultimoValor = bits;
+        
+        if (diferencia == 0) {
+            escribirBit(false);
+            return;
+        }
+        escribirBit(true);
+        
+        const int iniciales = __builtin_clz(diferencia);
+        const int finales = __builtin_ctz(diferencia);
+        
+        if (cerosIniciales != SIN_VENTANA && iniciales >= cerosIniciales && finales >= cerosFinales) {
+            escribirBit(false);
+            escribirBits(diferencia >> cerosFinales, 32 - cerosIniciales - cerosFinales);
+        } else {
+            const int significativos = 32 - iniciales - finales;
+            escribirBit(true);
+            escribirBits(static_cast<uint64_t>(iniciales), 5);
+            escribirBits(static_cast<uint64_t>(significativos - 1), 5);
+            escribirBits(diferencia >> finales, significativos);
+            cerosIniciales = iniciales;
+            cerosFinales = finales;
+        }
+    }
+    
+public:
+    /**
+     * @brief Constructor de bloque vacio
+     */
+    BloqueGorilla()
+        : bitsEscritos(0), cantidad(0), inicio(0), ultimaMarca(0), ultimoDelta(0),
+          ultimoValor(0), cerosIniciales(SIN_VENTANA), cerosFinales(0),
+          minimo(0.0f), maximo(0.0f), suma(0.0) {}
+    
+    /**
+     * @brief Agrega una medicion al final del bloque
+     * @param marca Marca de tiempo, no menor que la ultima agregada
+     * @param valor Medicion a codificar
+     */
+    void agregar(MarcaTiempo marca, float valor) {
+        if (cantidad == 0) {
+            inicio = marca;
+            ultimaMarca = marca;
+            ultimoValor = bitsDe(valor);
+            escribirBits(static_cast<uint64_t>(marca), 64);
+            escribirBits(ultimoValor, 32);
+            minimo = valor;
+            maximo = valor;
+        } else {
+            codificarMarca(marca);
+            codificarValor(bitsDe(valor));
+            if (valor < minimo) {
+                minimo = valor;
+            }
+            if (valor > maximo) {
+                maximo = valor;
+            }
+        }
+        suma += valor;
+        cantidad++;
+    }
+    
+    /**
+     * @brief Decodifica en flujo todas las mediciones del bloque
+     * @tparam Operacion Funcion invocada como operacion(marca, valor)
+     * @param operacion Funcion que se aplicara a cada medicion en orden
+     */
+    template <typename Operacion>
+    void iterar(Operacion operacion) const {
+        if (cantidad == 0) {
+            return;
+        }
+        LectorBits lector(palabras);
+        MarcaTiempo marca = static_cast<MarcaTiempo>(lector.leer(64));
+        uint32_t bits = static_cast<uint32_t>(lector.leer(32));
+        int64_t delta = 0;
+        int iniciales = 0;
+        int finales = 0;
+        operacion(marca, valorDe(bits));
+        
+        for (int i = 1; i < cantidad; i++) {
+            if (lector.leerBit()) {
+                int64_t deltaDeDelta;
+                if (!lector.leerBit()) {
+                    deltaDeDelta = extenderSigno(lector.leer(7), 7);
+                } else if (!lector.leerBit()) {
+                    deltaDeDelta = extenderSigno(lector.leer(9), 9);
+                } else if (!lector.leerBit()) {
+                    deltaDeDelta = extenderSigno(lector.leer(12), 12);
+                } else {
+                    deltaDeDelta = static_cast<int64_t>(lector.leer(64));
+                }
+                delta += deltaDeDelta;
+            }
+            marca += delta;
+            
+            if (lector.leerBit()) {
+                if (lector.leerBit()) {
+                    iniciales = static_cast<int>(lector.leer(5));
+                    const int significativos = static_cast<int>(lector.leer(5)) + 1;
+                    finales = 32 - iniciales - significativos;
+                }
+                const int significativos = 32 - iniciales - finales;
+                bits ^= static_cast<uint32_t>(lector.leer(significativos)) << finales;
+            }
+            operacion(marca, valorDe(bits));
+        }
+    }
+    
+    /**
+     * @brief Ajusta la reserva de memoria al tamanio codificado
+     * 
+     * Se invoca al cerrar el bloque, cuando ya no recibira mediciones.
+     */
+    void compactar() {
+        std::vector<uint64_t>(palabras).swap(palabras);
+    }
+    
+    /**
+     * @brief Traslada todas las marcas del bloque
+     * @param desplazamiento Milisegundos a sumar a cada marca
+     * 
+     * Solo la primera marca esta escrita en crudo (la primera palabra del
+     * flujo); las demas son diferencias y no cambian.
+     */
+    void desplazarMarcas(MarcaTiempo desplazamiento) {
+        if (cantidad == 0) {
+            return;
+        }
+        inicio += desplazamiento;
+        ultimaMarca += desplazamiento;
+        palabras[0] = static_cast<uint64_t>(inicio);
+    }
+    
+    /**
+     * @brief Agregados del bloque completo, sin decodificarlo
+     * @return Cantidad, minimo, maximo y suma del bloque
+     */
+    ResumenRango resumir() const {
+        ResumenRango resumen;
+        if (cantidad > 0) {
+            resumen.cantidad = cantidad;
+            resumen.minimo = minimo;
+            resumen.maximo = maximo;
+            resumen.suma = suma;
+        }
+        return resumen;
+    }
+    
+    int getCantidad() const { return cantidad; }
+    MarcaTiempo getInicio() const { return inicio; }
+    MarcaTiempo getFin() const { return ultimaMarca; }
+    uint64_t getBits() const { return bitsEscritos; }
+    
+    /**
+     * @brief Memoria ocupada por el bloque
+     * @return Bytes reservados para los bits y el estado del bloque
+     */
+    std::size_t bytesOcupados() const {
+        return sizeof(BloqueGorilla) + palabras.capacity() * sizeof(uint64_t);
+    }
+    
+    /**
+     * @brief Escribe el bloque, incluido su estado de codificacion
+     * @param salida Flujo binario de destino
+     */
+    void guardar(std::ostream& salida) const {
+        escribirBinario(salida, cantidad);
+        escribirBinario(salida, inicio);
+        escribirBinario(salida, ultimaMarca);
+        escribirBinario(salida, ultimoDelta);
+        escribirBinario(salida, ultimoValor);
+        escribirBinario(salida, cerosIniciales);
+        escribirBinario(salida, cerosFinales);
+        escribirBinario(salida, minimo);
+        escribirBinario(salida, maximo);
+        escribirBinario(salida, suma);
+        escribirBinario(salida, bitsEscritos);
+        escribirVectorBinario(salida, palabras);
+    }
+    
+    /**
+     * @brief Restaura un bloque escrito con guardar()
+     * @param entrada Flujo binario de origen
+     * @return true si la lectura fue completa y coherente
+     */
+    bool cargar(std::istream& entrada) {
+        return leerBinario(entrada, cantidad) && leerBinario(entrada, inicio) &&
+               leerBinario(entrada, ultimaMarca) && leerBinario(entrada, ultimoDelta) &&
+               leerBinario(entrada, ultimoValor) && leerBinario(entrada, cerosIniciales) &&
+               leerBinario(entrada, cerosFinales) && leerBinario(entrada, minimo) &&
+               leerBinario(entrada, maximo) && leerBinario(entrada, suma) &&
+               leerBinario(entrada, bitsEscritos) &&
+               leerVectorBinario(entrada, palabras) &&
+               (bitsEscritos + 63) / 64 == palabras.size();
+    }
+};
+
+/**
+ * @class HistorialGorilla
+ * @brief Secuencia de bloques Gorilla con agregado en flujo
+ * 
+ * Las mediciones se agregan al ultimo bloque, que se cierra al alcanzar
+ * la capacidad configurada. Bloques acotados permiten recorrer o descartar
+ * partes del historial sin decodificarlo completo.
+ */
+class HistorialGorilla {
+private:
+    std::vector<BloqueGorilla> bloques;  ///< Bloques en orden cronologico; el ultimo esta abierto
+    int capacidadBloque;                 ///< Mediciones por bloque antes de cerrarlo
+    long long cantidad;                  ///< Mediciones totales del historial
+    
+public:
+    /**
+     * @brief Constructor
+     * @param capacidad Mediciones por bloque (por defecto 1024)
+     */
+    explicit HistorialGorilla(int capacidad = 1024)
+        : capacidadBloque(capacidad > 1 ? capacidad : 2), cantidad(0) {}
+    
+    /**
+     * @brief Agrega una medicion al final del historial
+     * @param marca Marca de tiempo, no menor que la ultima agregada
+     * @param valor Medicion a codificar
+     */
+    void agregar(MarcaTiempo marca, float valor) {
+        if (bloques.empty() || bloques.back().getCantidad() >= capacidadBloque) {
+            if (!bloques.empty()) {
+                bloques.back().compactar();
+            }
+            bloques.push_back(BloqueGorilla());
+        }
+        bloques.back().agregar(marca, valor);
+        cantidad++;
+    }
+    
+    /**
+     * @brief Decodifica en flujo todo el historial
+     * @tparam Operacion Funcion invocada como operacion(marca, valor)
+     * @param operacion Funcion que se aplicara a cada medicion en orden
+     */
+    template <typename Operacion>
+    void iterar(Operacion operacion) const {
+        for (std::size_t i = 0; i < bloques.size(); i++) {
+            bloques[i].iterar(operacion);
+        }
+    }
+    
+    /**
+     * @brief Acumula las mediciones con marca en [desde, hasta)
+     * @param desde Inicio del intervalo (incluido)
+     * @param hasta Fin del intervalo (excluido)
+     * @param resumen Agregados donde se incorporan las mediciones
+     * 
+     * Localiza el primer bloque por busqueda binaria sobre las marcas
+     * finales. Los bloques contenidos por completo en el intervalo aportan
+     * su resumen sin decodificarse; solo los bloques de los extremos se
+     * decodifican.
+     */
+    void acumularRango(MarcaTiempo desde, MarcaTiempo hasta, ResumenRango& resumen) const {
+        std::vector<BloqueGorilla>::const_iterator bloque = std::lower_bound(
+            bloques.begin(), bloques.end(), desde,
+            [](const BloqueGorilla& actual, MarcaTiempo marca) { return actual.getFin() < marca; });
+        
+        for (; bloque != bloques.end() && bloque->getInicio() < hasta; ++bloque) {
+            if (desde <= bloque->getInicio() && bloque->getFin() < hasta) {
+                resumen.combinar(bloque->resumir());
+            } else {
+                bloque->iterar([desde, hasta, &resumen](MarcaTiempo marca, float valor) {
+                    if (marca >= desde && marca < hasta) {
+                        resumen.incorporar(valor);
+                    }
+                });
+            }
+        }
+    }
+    
+    /**
+     * @brief Agregados de todo el historial
+     * @return Cantidad, minimo, maximo y suma, obtenidos de las cabeceras de bloque
+     */
+    ResumenRango resumir() const {
+        ResumenRango resumen;
+        for (std::size_t i = 0; i < bloques.size(); i++) {
+            resumen.combinar(bloques[i].resumir());
+        }
+        return resumen;
+    }
+    
+    /**
+     * @brief Elimina todas las mediciones del historial
+     */
+    void vaciar() {
+        std::vector<BloqueGorilla>().swap(bloques);
+        cantidad = 0;
+    }
+    
+    /**
+     * @brief Traslada todas las marcas del historial
+     * @param desplazamiento Milisegundos a sumar a cada marca
+     */
+    void desplazarMarcas(MarcaTiempo desplazamiento) {
+        for (std::size_t i = 0; i < bloques.size(); i++) {
+            bloques[i].desplazarMarcas(desplazamiento);
+        }
+    }
+    
+    long long getCantidad() const { return cantidad; }
+    bool estaVacio() const { return cantidad == 0; }
+    int getCantidadBloques() const { return static_cast<int>(bloques.size()); }
+    
+    /**
+     * @brief Marca de tiempo de la ultima medicion del historial
+     * @return Ultima marca, o la menor marca representable si esta vacio
+     */
+    MarcaTiempo getUltimaMarca() const {
+        return bloques.empty() ? std::numeric_limits<MarcaTiempo>::min() : bloques.back().getFin();
+    }
+    
+    /**
+     * @brief Memoria ocupada por el historial comprimido
+     * @return Bytes del objeto y de todos los bloques reservados
+     */
+    std::size_t bytesOcupados() const {
+        std::size_t total = sizeof(HistorialGorilla) + (bloques.capacity() - bloques.size()) * sizeof(BloqueGorilla);
+        for (std::size_t i = 0; i < bloques.size(); i++) {
+            total += bloques[i].bytesOcupados();
+        }
+        return total;
+    }
+    
+    /**
+     * @brief Escribe el historial completo
+     * @param salida Flujo binario de destino
+     */
+    void guardar(std::ostream& salida) const {
+        const uint32_t totalBloques = static_cast<uint32_t>(bloques.size());
+        escribirBinario(salida, capacidadBloque);
+        escribirBinario(salida, totalBloques);
+        for (std::size_t i = 0; i < bloques.size(); i++) {
+            bloques[i].guardar(salida);
+        }
+    }
+    
+    /**
+     * @brief Reemplaza el historial por uno escrito con guardar()
+     * @param entrada Flujo binario de origen
+     * @return true si la lectura fue completa y coherente
+     */
+    bool cargar(std::istream& entrada) {
+        uint32_t totalBloques = 0;
+        if (!leerBinario(entrada, capacidadBloque) || !leerBinario(entrada, totalBloques) ||
+            capacidadBloque < 2) {
+            return false;
+        }
+        vaciar();
+        // Los bloques se agregan a medida que se leen: un total danado no reserva memoria
+        for (uint32_t i = 0; i < totalBloques; i++) {
+            BloqueGorilla bloque;
+            if (!bloque.cargar(entrada)) {
+                vaciar();
+                return false;
+            }
+            cantidad += bloque.getCantidad();
+            bloques.push_back(std::move(bloque));
+        }
+        return true;
+    }
+};
+
+#endif // HISTORIALGORILLA_H
@@ -0,0 +1,110 @@
+/**
+ * @file IndiceSensores.h
+ * @brief Indices ordenados del registro de sensores
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef INDICESENSORES_H
+#define INDICESENSORES_H
+
+#include "ColeccionSensores.h"
+#include "ListaOrdenada.h"
+#include "SensorBase.h"
+#include "TablaIdentificadores.h"
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/**
+ * @struct OrdenPorNombre
+ * @brief Ordena sensores alfabeticamente por codigo; admite consultas con un nombre
+ */
+struct OrdenPorNombre {
+    bool operator()(const SensorBase* a, const SensorBase* b) const {
+        return std::strcmp(a->getNombre(), b->getNombre()) < 0;
+    }
+    bool operator()(const SensorBase* a, const char* nombre) const {
+        return std::strcmp(a->getNombre(), nombre) < 0;
+    }
+    bool operator()(const char* nombre, const SensorBase* b) const {
+        return std::strcmp(nombre, b->getNombre()) < 0;
+    }
+};
+
+/**
+ * @struct OrdenPorIdentificador
+ * @brief Ordena sensores por identificador interno; admite consultas con un IdSensor
+ */
+struct OrdenPorIdentificador {
+    bool operator()(const SensorBase* a, const SensorBase* b) const {
+        return a->getId() < b->getId();
+    }
+    bool operator()(const SensorBase* a, IdSensor id) const {
+        return a->getId() < id;
+    }
+    bool operator()(IdSensor id, const SensorBase* b) const {
+        return id < b->getId();
+    }
+};
+
+/// Indice alfabetico del registro
+typedef ListaOrdenada<SensorBase*, OrdenPorNombre> IndiceNombres;
+
+/// Indice por identificador del registro
+typedef ListaOrdenada<SensorBase*, OrdenPorIdentificador> IndiceIdentificadores;
+
+/**
+ * @brief Carga en un indice todos los sensores del registro
+ * @tparam Indice ListaOrdenada de SensorBase* con cualquier criterio
+ * @return Cantidad de sensores indexados
+ * 
+ * El indice no es duenio de los sensores: debe reconstruirse o
+ * actualizarse si el registro cambia.
+ */
+template <typename Indice>
+int indexarRegistro(const ColeccionSensores* registro, Indice& indice) {
+    indice.vaciar();
+    registro->iterar([&indice](SensorBase* dispositivo) {
+        indice.insertar(dispositivo);
+    });
+    return indice.getTamanio();
+}
+
+/**
+ * @brief Lista en orden alfabetico los sensores cuyo codigo empieza con un prefijo
+ * @param registro Coleccion de sensores
+ * @param prefijo Prefijo buscado (vacio = todos)
+ * @return Cantidad de sensores listados
+ * 
+ * El indice ubica el primer codigo que no es menor que el prefijo y el
+ * recorrido se detiene en el primero que ya no lo comparte.
+ */
+inline int listarSensores(const ColeccionSensores* registro, const std::string& prefijo) {
+    IndiceNombres indice;
+    indexarRegistro(registro, indice);
+    
+    std::cout << "\n<<< Sensores registrados >>>" << std::endl;
+    int listados = 0;
+    for (const NodoSalto<SensorBase*>* nodo = indice.limiteInferior(prefijo.c_str()); nodo != nullptr;
+         nodo = nodo->siguiente[0]) {
+        const SensorBase* dispositivo = nodo->dato;
+        if (std::strncmp(dispositivo->getNombre(), prefijo.c_str(), prefijo.size()) != 0) {
+            break;
+        }
+        std::cout << "  " << std::left << std::setw(16) << dispositivo->getNombre() << std::right
+                  << (dispositivo->getTipo() == SENSOR_TEMPERATURA ? "  temperatura" : "  presion    ")
+                  << std::setw(10) << dispositivo->getCantidadMediciones() << " mediciones" << std::endl;
+        listados++;
+    }
+    if (listados == 0) {
+        std::cout << "Ningun sensor coincide" << std::endl;
+    } else {
+        std::cout << listados << " de " << indice.getTamanio() << " sensores" << std::endl;
+    }
+    return listados;
+}
+
+#endif // INDICESENSORES_H
@@ -0,0 +1,127 @@
+/**
+ * @file InformeMemoria.h
+ * @brief Informe de memoria de todo el registro de sensores
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef INFORMEMEMORIA_H
+#define INFORMEMEMORIA_H
+
+#include "ColeccionSensores.h"
+#include "Nodo.h"
+#include "SensorBase.h"
+#include "TablaIdentificadores.h"
+#include "UsoMemoria.h"
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * @struct EntradaMemoria
+ * @brief Uso de memoria de un sensor dentro del informe
+ */
+struct EntradaMemoria {
+    const SensorBase* sensor;  ///< Sensor medido
+    UsoMemoria uso;            ///< Memoria del sensor
+};
+
+/**
+ * @brief Criterio de orden: primero los sensores que mas memoria ocupan
+ */
+inline bool ocupaMasMemoria(const EntradaMemoria& a, const EntradaMemoria& b) {
+    return a.uso.bytes > b.uso.bytes;
+}
+
+/**
+ * @brief Muestra la memoria del registro y los sensores mas pesados
+ * @param registro Coleccion de sensores
+ * @param presupuesto Bytes admitidos por sensor (0 = sin limite)
+ * @param limite Sensores listados en el ranking
+ * @return Cantidad de sensores que exceden el presupuesto
+ * 
+ * Informa el total por nivel de historial, la reserva de los pools de
+ * nodos frente a los nodos vivos del registro (la diferencia es holgura
+ * reciclable) y la tabla de nombres compartida. Los sensores que exceden
+ * el presupuesto se marcan aunque queden fuera del ranking.
+ */
+inline int informarMemoria(const ColeccionSensores* registro, std::size_t presupuesto, int limite = 10) {
+    std::vector<EntradaMemoria> entradas;
+    entradas.reserve(static_cast<std::size_t>(registro->getTamanio()));
+    UsoMemoria total;
+    long long nodosTermicos = 0;
+    long long nodosPresion = 0;
+    long long mediciones = 0;
+    registro->iterar([&](SensorBase* dispositivo) {
+        EntradaMemoria entrada;
+        entrada.sensor = dispositivo;
+        entrada.uso = dispositivo->getUsoMemoria();
+        total.acumular(entrada.uso);
+        if (dispositivo->getTipo() == SENSOR_TEMPERATURA) {
+            nodosTermicos += entrada.uso.nodosVivos;
+        } else {
+            nodosPresion += entrada.uso.nodosVivos;
+        }
+        mediciones += dispositivo->getCantidadMediciones();
+        entradas.push_back(entrada);
+    });
+    std::sort(entradas.begin(), entradas.end(), ocupaMasMemoria);
+    
+    std::cout << "\n<<< Uso de Memoria >>>" << std::endl;
+    std::cout << "Sensores: " << entradas.size() << "  Mediciones: " << mediciones << std::endl;
+    std::cout << "Total: " << total.bytes << " bytes (suma de picos " << total.bytesPico << ")" << std::endl;
+    std::cout << "  Nivel reciente:      " << total.bytesReciente << " bytes, "
+              << total.nodosVivos << " nodos (suma de picos " << total.nodosPico << ")" << std::endl;
+    std::cout << "  Historial comprimido: " << total.bytesArchivo << " bytes" << std::endl;
+    std::cout << "  Ventanas y boceto:   " << total.bytesAgregados << " bytes" << std::endl;
+    if (mediciones > 0) {
+        std::cout << "  Promedio: " << std::fixed << std::setprecision(2)
+                  << static_cast<double>(total.bytes) / mediciones << " bytes/medicion" << std::endl;
+    }
+    
+    const std::size_t reservaTermica = PoolNodos<float>::getBytesReservados();
+    const std::size_t reservaPresion = PoolNodos<int>::getBytesReservados();
+    const std::size_t usoTermico = static_cast<std::size_t>(nodosTermicos) * sizeof(Nodo<float>);
+    const std::size_t usoPresion = static_cast<std::size_t>(nodosPresion) * sizeof(Nodo<int>);
+    std::cout << "Pool de nodos termicos:   " << reservaTermica << " bytes reservados, "
+              << usoTermico << " en el registro" << std::endl;
+    std::cout << "Pool de nodos de presion: " << reservaPresion << " bytes reservados, "
+              << usoPresion << " en el registro" << std::endl;
+    std::cout << "Tabla de nombres: " << TablaIdentificadores::global().bytesOcupados() << " bytes ("
+              << TablaIdentificadores::global().getCantidad() << " nombres)" << std::endl;
+    
+    int excedidos = 0;
+    const int mostrados = std::min(limite, static_cast<int>(entradas.size()));
+    if (mostrados > 0) {
+        std::cout << "\nSensores con mayor consumo:" << std::endl;
+    }
+    for (std::size_t i = 0; i < entradas.size(); i++) {
+        const EntradaMemoria& entrada = entradas[i];
+        const bool excede = presupuesto > 0 && entrada.uso.bytes > presupuesto;
+        if (excede) {
+            excedidos++;
+        }
+        if (static_cast<int>(i) >= mostrados && !excede) {
+            continue;
+        }
+        std::cout << (excede ? "[WARN] " : "  ") << std::setw(3) << i + 1 << ". "
+                  << std::left << std::setw(16) << entrada.sensor->getNombre() << std::right
+                  << std::setw(10) << entrada.uso.bytes << " bytes (pico " << entrada.uso.bytesPico << ")"
+                  << "  reciente " << entrada.uso.bytesReciente
+                  << "  archivo " << entrada.uso.bytesArchivo
+                  << "  agregados " << entrada.uso.bytesAgregados
+                  << "  nodos " << entrada.uso.nodosVivos << "/" << entrada.uso.nodosPico << std::endl;
+    }
+    if (excedidos > 0) {
+        std::cout << "[WARN] " << excedidos << " sensores exceden el presupuesto de "
+                  << presupuesto << " bytes" << std::endl;
+    } else if (presupuesto > 0) {
+        std::cout << "[OK] Todos los sensores respetan el presupuesto de " << presupuesto << " bytes" << std::endl;
+    }
+    return excedidos;
+}
+
+#endif // INFORMEMEMORIA_H
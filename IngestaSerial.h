@@ -0,0 +1,233 @@
+/**
+ * @file IngestaSerial.h
+ * @brief Interpretacion de las lineas recibidas por el puerto serial
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef INGESTASERIAL_H
+#define INGESTASERIAL_H
+
+#include "ColeccionSensores.h"
+#include "Instrumentacion.h"
+#include "MotorAlertas.h"
+#include "RegistroSensores.h"
+#include "RelojMonotonico.h"
+#include "SensorPresion.h"
+#include "SensorTemperatura.h"
+#include "TablaIdentificadores.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/**
+ * @brief Localiza un sensor por su nombre
+ * @param registro Registro donde buscar
+ * @param codigo Nombre del sensor
+ * @return Primer sensor registrado con ese nombre, o nullptr si no existe
+ * 
+ * El nombre se traduce una sola vez a su identificador internado; el
+ * recorrido compara enteros en lugar de cadenas y se detiene en la
+ * primera coincidencia. Segun la politica de busqueda del registro, un
+ * sensor buscado repetidamente se resuelve sin recorrer la coleccion.
+ */
+inline SensorBase* localizarSensor(RegistroSensores* registro, const std::string& codigo) {
+    const IdSensor buscado = TablaIdentificadores::global().buscar(codigo);
+    if (buscado == TablaIdentificadores::ID_INVALIDO) {
+        return nullptr;
+    }
+    return registro->buscarSi([buscado](const SensorBase* dispositivo) {
+        return dispositivo->getId() == buscado;
+    });
+}
+
+/**
+ * @class IngestaSerial
+ * @brief Ruta de interpretacion, busqueda e insercion de cada linea recibida
+ * 
+ * Separa el tratamiento de una linea del ciclo de lectura del puerto, de
+ * modo que el mismo codigo procesa la captura en vivo y las reproducciones
+ * sinteticas de las pruebas de rendimiento.
+ * 
+ * El formato esperado es: TIPO ID VALOR
+ * - TIPO: 'T' para temperatura, 'P' para presion
+ * - ID: Identificador unico del sensor
+ * - VALOR: Medicion numerica (float para temperatura, int para presion)
+ * 
+ * Los mensajes por linea ([RX], [OK], [INFO]) respetan la bitacora; las
+ * advertencias por datos invalidos se emiten siempre.
+ * 
+ * En la captura unos pocos sensores concentran las busquedas: mientras la
+ * ingesta exista, el registro busca con BUSQUEDA_MOVER_AL_FRENTE y cada
+ * sensor localizado pasa al frente. Al destruirse restituye la politica
+ * anterior, de modo que las consultas del menu no reordenan el registro. Con la opcion
+ * SENSORES_INSTRUMENTACION, cada etapa alimenta su histograma de latencia.
+ */
+class IngestaSerial {
+private:
+    RegistroSensores* registro;     ///< Registro duenio de los sensores creados
+    MotorAlertas& alertasTermicas;  ///< Reglas para sensores termicos
+    MotorAlertas& alertasPresion;   ///< Reglas para sensores de presion
+    int contadorLecturas;           ///< Mediciones aceptadas
+    long long contadorLineas;       ///< Lineas recibidas, incluidas las de sistema
+    long long contadorRechazos;     ///< Lineas descartadas por formato invalido
+    PoliticaBusqueda politicaPrevia;  ///< Politica del registro antes de la captura
+    
+public:
+    /**
+     * @brief Constructor
+     * @param destino Registro donde se crean los sensores nuevos
+     * @param termicas Motor de alertas para mediciones de temperatura
+     * @param presion Motor de alertas para mediciones de presion
+     */
+    IngestaSerial(RegistroSensores* destino, MotorAlertas& termicas, MotorAlertas& presion)
+        : registro(destino), alertasTermicas(termicas), alertasPresion(presion), contadorLecturas(0),
+          contadorLineas(0), contadorRechazos(0),
+          politicaPrevia(destino->getPoliticaBusqueda()) {
+        registro->setPoliticaBusqueda(BUSQUEDA_MOVER_AL_FRENTE);
+    }
+    
+    /**
+     * @brief Destructor: restituye la politica de busqueda del registro
+     */
+    ~IngestaSerial() {
+        registro->setPoliticaBusqueda(politicaPrevia);
+    }
+    
+    IngestaSerial(const IngestaSerial&) = delete;
+    IngestaSerial& operator=(const IngestaSerial&) = delete;
+    
+    /**
+     * @brief Procesa una linea recibida
+     * @param buffer Linea sin el salto final
+     * @return true si la linea contenia una medicion valida
+     * 
+     * Los mensajes de sistema del Arduino y las lineas vacias se ignoran.
+     * Un sensor desconocido se crea con su primera medicion.
+     */
+    bool procesarLinea(const std::string& buffer) {
+        INSTRUMENTO_MARCA(marcaEtapa);
+        contadorLineas++;
+        
+        // Filtrar mensajes de sistema del Arduino
+        if (buffer.find("===") != std::string::npos ||
+            buffer.find("Arduino") != std::string::npos ||
+            buffer.find("Formato") != std::string::npos ||
+            buffer.empty()) {
+            INSTRUMENTO_CONTAR(CONTADOR_LINEAS_SISTEMA);
+            return false;
+        }
+        
+        if (Bitacora::activa()) {
+            std::cout << "[RX] Datos recibidos: " << buffer << std::endl;
+        }
+        
+        // Parseo de la cadena recibida
+        std::istringstream parser(buffer);
+        char tipoDispositivo;
+        std::string identificador;
+        
+        if (!(parser >> tipoDispositivo >> identificador)) {
+            INSTRUMENTO_CONTAR(CONTADOR_ERRORES_PARSEO);
+            contadorRechazos++;
+            std::cout << "[WARN] Formato de datos incorrecto, descartando..." << std::endl;
+            return false;
+        }
+        
+        const bool termico = tipoDispositivo == 'T' || tipoDispositivo == 't';
+        float temperatura = 0.0f;
+        int presion = 0;
+        if (termico) {
+            if (!(parser >> temperatura)) {
+                INSTRUMENTO_CONTAR(CONTADOR_ERRORES_PARSEO);
+                contadorRechazos++;
+                std::cout << "[WARN] Valor de temperatura invalido" << std::endl;
+                return false;
+            }
+        } else if (tipoDispositivo == 'P' || tipoDispositivo == 'p') {
+            if (!(parser >> presion)) {
+                INSTRUMENTO_CONTAR(CONTADOR_ERRORES_PARSEO);
+                contadorRechazos++;
+                std::cout << "[WARN] Valor de presion invalido" << std::endl;
+                return false;
+            }
+        } else {
+            INSTRUMENTO_CONTAR(CONTADOR_ERRORES_PARSEO);
+            contadorRechazos++;
+            std::cout << "[WARN] Tipo de dispositivo no reconocido: " << tipoDispositivo << std::endl;
+            return false;
+        }
+        INSTRUMENTO_ETAPA(ETAPA_PARSEO, marcaEtapa);
+        
+        // Verificar existencia previa del sensor
+        SensorBase* dispositivoExistente = localizarSensor(registro, identificador);
+        INSTRUMENTO_ETAPA(ETAPA_BUSQUEDA, marcaEtapa);
+        
+        const MarcaTiempo marca = RelojMonotonico::ahora();
+        if (termico) {
+            if (dispositivoExistente == nullptr) {
+                // Instanciar nuevo sensor termico
+                SensorTemperatura* nuevoDispositivo = registro->agregarTermico(identificador.c_str());
+                nuevoDispositivo->agregarLectura(temperatura, marca);
+                INSTRUMENTO_REINICIAR(marcaEtapa);
+                alertasTermicas.evaluar(nuevoDispositivo, temperatura, marca);
+                INSTRUMENTO_ETAPA(ETAPA_ALERTAS, marcaEtapa);
+                if (Bitacora::activa()) {
+                    std::cout << "[OK] Sensor termico '" << identificador << "' registrado" << std::endl;
+                }
+            } else if (dispositivoExistente->getTipo() == SENSOR_TEMPERATURA) {
+                // Actualizar sensor existente
+                SensorTemperatura* sensorTermico = static_cast<SensorTemperatura*>(dispositivoExistente);
+                sensorTermico->agregarLectura(temperatura, marca);
+                INSTRUMENTO_REINICIAR(marcaEtapa);
+                alertasTermicas.evaluar(sensorTermico, temperatura, marca);
+                INSTRUMENTO_ETAPA(ETAPA_ALERTAS, marcaEtapa);
+                if (Bitacora::activa()) {
+                    std::cout << "[OK] Medicion almacenada en '" << identificador << "': "
+                              << temperatura << " grados C" << std::endl;
+                }
+            } else {
+                INSTRUMENTO_CONTAR(CONTADOR_DESCARTES);
+            }
+        } else {
+            if (dispositivoExistente == nullptr) {
+                // Instanciar nuevo sensor de presion
+                SensorPresion* nuevoDispositivo = registro->agregarPresion(identificador.c_str());
+                nuevoDispositivo->agregarLectura(presion, marca);
+                INSTRUMENTO_REINICIAR(marcaEtapa);
+                alertasPresion.evaluar(nuevoDispositivo, presion, marca);
+                INSTRUMENTO_ETAPA(ETAPA_ALERTAS, marcaEtapa);
+                if (Bitacora::activa()) {
+                    std::cout << "[OK] Sensor de presion '" << identificador << "' registrado" << std::endl;
+                }
+            } else if (dispositivoExistente->getTipo() == SENSOR_PRESION) {
+                // Actualizar sensor existente
+                SensorPresion* sensorPresion = static_cast<SensorPresion*>(dispositivoExistente);
+                sensorPresion->agregarLectura(presion, marca);
+                INSTRUMENTO_REINICIAR(marcaEtapa);
+                alertasPresion.evaluar(sensorPresion, presion, marca);
+                INSTRUMENTO_ETAPA(ETAPA_ALERTAS, marcaEtapa);
+                if (Bitacora::activa()) {
+                    std::cout << "[OK] Medicion almacenada en '" << identificador << "': "
+                              << presion << " Pascales" << std::endl;
+                }
+            } else {
+                INSTRUMENTO_CONTAR(CONTADOR_DESCARTES);
+            }
+        }
+        
+        contadorLecturas++;
+        if (Bitacora::activa()) {
+            std::cout << "[INFO] Total de mediciones capturadas: " << contadorLecturas << "\n" << std::endl;
+        }
+        INSTRUMENTO_TERMINAR_LINEA();
+        return true;
+    }
+    
+    int getContadorLecturas() const { return contadorLecturas; }
+    long long getContadorLineas() const { return contadorLineas; }
+    long long getContadorRechazos() const { return contadorRechazos; }
+};
+
+#endif // INGESTASERIAL_H
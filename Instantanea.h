@@ -0,0 +1,245 @@
+/**
+ * @file Instantanea.h
+ * @brief Persistencia binaria del registro completo de sensores
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef INSTANTANEA_H
+#define INSTANTANEA_H
+
+#include "ColeccionSensores.h"
+#include "RegistroSensores.h"
+#include "SensorTemperatura.h"
+#include "SensorPresion.h"
+#include "Bitacora.h"
+#include "FormatoBinario.h"
+#include "RelojMonotonico.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class Instantanea
+ * @brief Guarda y restaura la coleccion de sensores en un archivo binario
+ * 
+ * Formato (version 6, orden de bytes nativo):
+ * - Cabecera: magia "SNSR", version (uint32), marca de orden 0x01020304 (uint32),
+ *   ancla monotonica y ancla del sistema (int64 cada una, en ms) y cantidad de
+ *   sensores (uint32).
+ * - Por sensor: tipo (uint8, 'T' o 'P'), longitud del nombre (uint8), nombre,
+ *   longitud de la carga (uint64) y carga producida por SensorBase::guardarEstado.
+ * 
+ * La longitud de la carga permite omitir tipos de sensor desconocidos y
+ * verificar que cada sensor consumio exactamente sus bytes.
+ * 
+ * Las marcas de las mediciones provienen del reloj monotonico, cuyo origen
+ * cambia con cada arranque del equipo. Las anclas son RelojMonotonico::ahora()
+ * y RelojMonotonico::sistema() tomados al guardar; al cargar, cada marca se
+ * traslada al reloj monotonico actual conservando su hora del sistema. Si la
+ * hora del sistema retrocedio, el traslado se limita para que ninguna marca
+ * quede en el futuro.
+ */
+class Instantanea {
+public:
+    static const uint32_t VERSION = 6;  ///< Version actual del formato
+    
+    /**
+     * @brief Guarda todos los sensores del registro en un archivo
+     * @param registro Coleccion de sensores a persistir
+     * @param ruta Ruta del archivo de destino
+     * @return true si el archivo se escribio completo, false en caso contrario
+     */
+    static bool guardar(const ColeccionSensores& registro, const std::string& ruta) {
+        std::ofstream salida(ruta.c_str(), std::ios::binary | std::ios::trunc);
+        if (!salida) {
+            std::cerr << "[ERROR] Imposible crear la instantanea " << ruta << std::endl;
+            return false;
+        }
+        
+        escribirCabecera(salida, static_cast<uint32_t>(registro.getTamanio()));
+        
+        long long totalMediciones = 0;
+        bool exito = static_cast<bool>(salida);
+        registro.iterar([&salida, &exito, &totalMediciones](SensorBase* dispositivo) {
+            if (!exito) {
+                return;
+            }
+            totalMediciones += dispositivo->getCantidadMediciones();
+            exito = escribirRegistro(salida, *dispositivo);
+        });
+        
+        if (!exito || !salida.flush()) {
+            std::cerr << "[ERROR] Fallo de escritura en la instantanea " << ruta << std::endl;
+            return false;
+        }
+        std::cout << "[Instantanea] " << registro.getTamanio() << " sensores y " << totalMediciones
+                  << " mediciones guardados en " << ruta << std::endl;
+        return true;
+    }
+    
+    /**
+     * @brief Agrega al registro los sensores de un archivo de instantanea
+     * @param registro Registro que creara los sensores restaurados
+     * @param ruta Ruta del archivo de origen
+     * @return true si todos los sensores se restauraron, false en caso contrario
+     * 
+     * Los historiales se restauran por bloques, sin pasar por la insercion
+     * individual ni por los mensajes de traza de cada elemento. Ante un error,
+     * los sensores ya restaurados permanecen en el registro.
+     */
+    static bool cargar(RegistroSensores& registro, const std::string& ruta) {
+        std::ifstream entrada(ruta.c_str(), std::ios::binary);
+        if (!entrada) {
+            std::cerr << "[ERROR] Imposible abrir la instantanea " << ruta << std::endl;
+            return false;
+        }
+        
+        uint32_t cantidadSensores = 0;
+        MarcaTiempo desplazamiento = 0;
+        if (!leerCabecera(entrada, cantidadSensores, desplazamiento)) {
+            std::cerr << "[ERROR] Cabecera de instantanea invalida o version no soportada" << std::endl;
+            return false;
+        }
+        
+        uint32_t restaurados = 0;
+        {
+            SilencioBitacora silencio;
+            for (uint32_t i = 0; i < cantidadSensores; i++) {
+                if (!leerRegistro(entrada, registro, desplazamiento, restaurados)) {
+                    break;
+                }
+            }
+        }
+        
+        if (restaurados != cantidadSensores) {
+            std::cerr << "[ERROR] Instantanea incompleta: " << restaurados << " de "
+                      << cantidadSensores << " sensores restaurados" << std::endl;
+            return false;
+        }
+        std::cout << "[Instantanea] " << restaurados << " sensores restaurados desde " << ruta << std::endl;
+        return true;
+    }
+    
+private:
+    static const uint32_t MARCA_ORDEN = 0x01020304;  ///< Detecta archivos de otra arquitectura
+    
+    static void escribirCabecera(std::ostream& salida, uint32_t cantidadSensores) {
+        const uint32_t version = VERSION;
+        const uint32_t marca = MARCA_ORDEN;
+        const MarcaTiempo anclaMonotonica = RelojMonotonico::ahora();
+        const int64_t anclaSistema = RelojMonotonico::sistema();
+        salida.write("SNSR", 4);
+        escribirBinario(salida, version);
+        escribirBinario(salida, marca);
+        escribirBinario(salida, anclaMonotonica);
+        escribirBinario(salida, anclaSistema);
+        escribirBinario(salida, cantidadSensores);
+    }
+    
+    /**
+     * @brief Lee la cabecera y calcula el traslado de las marcas
+     * @param desplazamiento Recibe los milisegundos a sumar a cada marca guardada
+     */
+    static bool leerCabecera(std::istream& entrada, uint32_t& cantidadSensores, MarcaTiempo& desplazamiento) {
+        char magia[4];
+        uint32_t version = 0;
+        uint32_t marca = 0;
+        MarcaTiempo anclaMonotonica = 0;
+        int64_t anclaSistema = 0;
+        if (!entrada.read(magia, 4) || std::memcmp(magia, "SNSR", 4) != 0) {
+            return false;
+        }
+        if (!leerBinario(entrada, version) || version != VERSION) {
+            return false;
+        }
+        if (!leerBinario(entrada, marca) || marca != MARCA_ORDEN) {
+            return false;
+        }
+        if (!leerBinario(entrada, anclaMonotonica) || !leerBinario(entrada, anclaSistema)) {
+            return false;
+        }
+        // Toda marca guardada es anterior a anclaMonotonica: con el limite,
+        // ninguna queda despues de ahora
+        const MarcaTiempo ahora = RelojMonotonico::ahora();
+        desplazamiento = std::min((ahora - RelojMonotonico::sistema()) - (anclaMonotonica - anclaSistema),
+                                  ahora - anclaMonotonica);
+        return leerBinario(entrada, cantidadSensores);
+    }
+    
+    /**
+     * @brief Escribe un sensor, completando la longitud de su carga al final
+     */
+    static bool escribirRegistro(std::ostream& salida, const SensorBase& dispositivo) {
+        const uint8_t longitudNombre = static_cast<uint8_t>(std::strlen(dispositivo.getNombre()));
+        escribirBinario(salida, static_cast<uint8_t>(dispositivo.getTipo()));
+        escribirBinario(salida, longitudNombre);
+        salida.write(dispositivo.getNombre(), longitudNombre);
+        
+        const std::streampos posicionLongitud = salida.tellp();
+        uint64_t longitudCarga = 0;
+        escribirBinario(salida, longitudCarga);
+        
+        if (!dispositivo.guardarEstado(salida)) {
+            return false;
+        }
+        const std::streampos posicionFinal = salida.tellp();
+        longitudCarga = static_cast<uint64_t>(posicionFinal - posicionLongitud) - sizeof(uint64_t);
+        
+        salida.seekp(posicionLongitud);
+        escribirBinario(salida, longitudCarga);
+        salida.seekp(posicionFinal);
+        return static_cast<bool>(salida);
+    }
+    
+    /**
+     * @brief Restaura un sensor y lo inserta en el registro
+     * @param desplazamiento Milisegundos a sumar a las marcas del sensor
+     * @param restaurados Contador que se incrementa si el sensor fue restaurado
+     * @return false si el archivo esta danado y la carga debe detenerse
+     * 
+     * El sensor se da de alta antes de leer su carga; si la carga esta
+     * danada, se retira del registro.
+     */
+    static bool leerRegistro(std::istream& entrada, RegistroSensores& registro, MarcaTiempo desplazamiento,
+                             uint32_t& restaurados) {
+        uint8_t tipo = 0;
+        uint8_t longitudNombre = 0;
+        char nombre[50];
+        uint64_t longitudCarga = 0;
+        if (!leerBinario(entrada, tipo) || !leerBinario(entrada, longitudNombre) ||
+            longitudNombre >= sizeof(nombre) ||
+            !entrada.read(nombre, longitudNombre) || !leerBinario(entrada, longitudCarga)) {
+            return false;
+        }
+        nombre[longitudNombre] = '\0';
+        
+        SensorBase* dispositivo = nullptr;
+        if (tipo == SENSOR_TEMPERATURA) {
+            dispositivo = registro.agregarTermico(nombre);
+        } else if (tipo == SENSOR_PRESION) {
+            dispositivo = registro.agregarPresion(nombre);
+        } else {
+            std::cerr << "[WARN] Tipo de sensor desconocido en instantanea, omitiendo " << nombre << std::endl;
+            entrada.seekg(static_cast<std::streamoff>(longitudCarga), std::ios::cur);
+            return static_cast<bool>(entrada);
+        }
+        
+        const std::streampos inicioCarga = entrada.tellg();
+        if (!dispositivo->cargarEstado(entrada) ||
+            static_cast<uint64_t>(entrada.tellg() - inicioCarga) != longitudCarga) {
+            registro.retirar(dispositivo);
+            return false;
+        }
+        dispositivo->desplazarMarcas(desplazamiento);
+        restaurados++;
+        return true;
+    }
+};
+
+#endif // INSTANTANEA_H
@@ -0,0 +1,406 @@
+/**
+ * @file Instrumentacion.h
+ * @brief Histogramas de latencia y contadores de la ruta de ingesta
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef INSTRUMENTACION_H
+#define INSTRUMENTACION_H
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+/**
+ * @enum EtapaIngesta
+ * @brief Tramos medidos entre la llegada de una linea y su almacenamiento
+ */
+enum EtapaIngesta {
+    ETAPA_LECTURA = 0,     ///< Del primer byte de la linea a su terminador (SerialPort::leerLinea)
+    ETAPA_PARSEO = 1,      ///< Interpretacion de tipo, identificador y valor
+    ETAPA_BUSQUEDA = 2,    ///< Localizacion del sensor por nombre
+    ETAPA_INSERCION = 3,   ///< Registro en la lista reciente y compactacion
+    ETAPA_AGREGACION = 4,  ///< Ventanas moviles y boceto de percentiles
+    ETAPA_ALERTAS = 5,     ///< Evaluacion de reglas de alerta
+    ETAPA_TOTAL = 6,       ///< Del primer byte al fin del procesamiento
+    CANTIDAD_ETAPAS = 7
+};
+
+/**
+ * @enum ContadorIngesta
+ * @brief Eventos contabilizados en la ruta de ingesta
+ */
+enum ContadorIngesta {
+    CONTADOR_LINEAS = 0,            ///< Lineas recibidas completas
+    CONTADOR_LINEAS_SISTEMA = 1,    ///< Mensajes de sistema del Arduino ignorados
+    CONTADOR_ERRORES_PARSEO = 2,    ///< Lineas con formato, tipo o valor invalido
+    CONTADOR_DESCARTES = 3,         ///< Mediciones para un sensor existente de otro tipo
+    CONTADOR_ERRORES_LECTURA = 4,   ///< Fallos de lectura del puerto
+    CANTIDAD_CONTADORES = 5
+};
+
+/**
+ * @class HistogramaLatencia
+ * @brief Histograma log-lineal de duraciones en nanosegundos, al estilo HDR
+ * 
+ * Cada potencia de dos se divide en SUBCUBETAS cubetas iguales, de modo
+ * que el error relativo de cualquier percentil es menor que 1/SUBCUBETAS
+ * (alrededor del 3%) para valores entre 1 ns y varios minutos. Registrar
+ * cuesta un desplazamiento, un conteo de ceros y un incremento.
+ * 
+ * Un unico hilo registra; los contadores son atomicos con orden relajado
+ * para que otro hilo pueda exportarlos sin detener la ingesta.
+ */
+class HistogramaLatencia {
+public:
+    static const int BITS_SUBCUBETA = 5;                     ///< log2 de SUBCUBETAS
+    static const int SUBCUBETAS = 1 << BITS_SUBCUBETA;       ///< Cubetas por potencia de dos
+    static const int CUBETAS = (65 - BITS_SUBCUBETA) * SUBCUBETAS;  ///< Cubre todo uint64_t
+    
+private:
+    std::atomic<uint64_t> cubetas[CUBETAS];  ///< Conteo por cubeta
+    std::atomic<uint64_t> cantidad;          ///< Duraciones registradas
+    std::atomic<uint64_t> suma;              ///< Suma de duraciones
+    std::atomic<uint64_t> maximo;            ///< Mayor duracion registrada
+    
+    /// Incremento sin instruccion atomica de lectura-modificacion (un solo escritor)
+    static void sumar(std::atomic<uint64_t>& contador, uint64_t incremento) {
+        contador.store(contador.load(std::memory_order_relaxed) + incremento, std::memory_order_relaxed);
+    }
+    
+public:
+    HistogramaLatencia() {
+        vaciar();
+    }
+    
+    /**
+     * @brief Cubeta que corresponde a un valor
+     */
+    static int indice(uint64_t valor) {
+        const uint64_t limiteLineal = 2 * SUBCUBETAS;
+        if (valor < limiteLineal) {
+            return static_cast<int>(valor);
+        }
+        const int exponente = 63 - __builtin_clzll(valor) - BITS_SUBCUBETA;
+        return (exponente + 1) * SUBCUBETAS + static_cast<int>((valor >> exponente) - SUBCUBETAS);
+    }
+    
+    /**
+     * @brief Menor valor representado por una cubeta
+     */
+    static uint64_t limiteInferior(int cubeta) {
+        if (cubeta < 2 * SUBCUBETAS) {
+            return static_cast<uint64_t>(cubeta);
+        }
+        const int exponente = cubeta / SUBCUBETAS - 1;
+        return static_cast<uint64_t>(cubeta % SUBCUBETAS + SUBCUBETAS) << exponente;
+    }
+    
+    /**
+     * @brief Registra una duracion
+     * @param nanosegundos Duracion medida
+     */
+    void registrar(uint64_t nanosegundos) {
+        sumar(cubetas[indice(nanosegundos)], 1);
+        sumar(cantidad, 1);
+        sumar(suma, nanosegundos);
+        if (nanosegundos > maximo.load(std::memory_order_relaxed)) {
+            maximo.store(nanosegundos, std::memory_order_relaxed);
+        }
+    }
+    
+    /**
+     * @brief Estima un percentil
+     * @param q Fraccion acumulada buscada (0.5 mediana, 0.99 percentil 99)
+     * @return Limite inferior de la cubeta que alcanza q; 0 si no hay registros
+     */
+    uint64_t percentil(double q) const {
+        const uint64_t total = cantidad.load(std::memory_order_relaxed);
+        if (total == 0) {
+            return 0;
+        }
+        const double objetivo = q * static_cast<double>(total);
+        uint64_t acumulado = 0;
+        for (int i = 0; i < CUBETAS; i++) {
+            acumulado += cubetas[i].load(std::memory_order_relaxed);
+            if (acumulado > 0 && static_cast<double>(acumulado) >= objetivo) {
+                return limiteInferior(i);
+            }
+        }
+        return maximo.load(std::memory_order_relaxed);
+    }
+    
+    /**
+     * @brief Descarta todos los registros
+     */
+    void vaciar() {
+        for (int i = 0; i < CUBETAS; i++) {
+            cubetas[i].store(0, std::memory_order_relaxed);
+        }
+        cantidad.store(0, std::memory_order_relaxed);
+        suma.store(0, std::memory_order_relaxed);
+        maximo.store(0, std::memory_order_relaxed);
+    }
+    
+    uint64_t getCantidad() const { return cantidad.load(std::memory_order_relaxed); }
+    uint64_t getMaximo() const { return maximo.load(std::memory_order_relaxed); }
+    uint64_t getSuma() const { return suma.load(std::memory_order_relaxed); }
+    
+    double getMedia() const {
+        const uint64_t total = getCantidad();
+        return total == 0 ? 0.0 : static_cast<double>(suma.load(std::memory_order_relaxed)) / total;
+    }
+};
+
+/**
+ * @class Instrumentacion
+ * @brief Histogramas por etapa y contadores de la ruta de ingesta
+ * 
+ * Las mediciones se insertan con las macros INSTRUMENTO_*, que solo
+ * generan codigo si el proyecto se compila con SENSORES_INSTRUMENTACION
+ * (opcion de CMake del mismo nombre). Sin ella, la ruta de ingesta queda
+ * identica a la version sin instrumentar.
+ */
+class Instrumentacion {
+private:
+    HistogramaLatencia etapas[CANTIDAD_ETAPAS];           ///< Latencia por etapa
+    std::atomic<uint64_t> contadores[CANTIDAD_CONTADORES];  ///< Eventos por tipo
+    uint64_t inicioLinea;                                  ///< Instante del primer byte de la linea en curso
+    
+    Instrumentacion() : inicioLinea(0) {
+        for (int i = 0; i < CANTIDAD_CONTADORES; i++) {
+            contadores[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    
+public:
+    Instrumentacion(const Instrumentacion&) = delete;
+    Instrumentacion& operator=(const Instrumentacion&) = delete;
+    
+    /**
+     * @brief Instancia unica compartida por la ruta de ingesta
+     */
+    static Instrumentacion& global() {
+        static Instrumentacion instancia;
+        return instancia;
+    }
+    
+    /**
+     * @brief Instante actual del reloj monotonico
+     * @return Nanosegundos desde un origen fijo
+     */
+    static uint64_t ahora() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    
+    /**
+     * @brief Registra la duracion de una etapa que comenzo en desde
+     * @return Instante de fin, que sirve de inicio a la etapa siguiente
+     */
+    uint64_t registrar(EtapaIngesta etapa, uint64_t desde) {
+        const uint64_t fin = ahora();
+        etapas[etapa].registrar(fin - desde);
+        return fin;
+    }
+    
+    /**
+     * @brief Incrementa un contador
+     */
+    void contar(ContadorIngesta contador) {
+        std::atomic<uint64_t>& destino = contadores[contador];
+        destino.store(destino.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    
+    /**
+     * @brief Marca la llegada del primer byte de una linea
+     */
+    void iniciarLinea(uint64_t instante) {
+        inicioLinea = instante;
+    }
+    
+    /**
+     * @brief Registra el tramo de lectura de la linea en curso
+     */
+    void terminarLectura() {
+        if (inicioLinea != 0) {
+            etapas[ETAPA_LECTURA].registrar(ahora() - inicioLinea);
+        }
+    }
+    
+    /**
+     * @brief Registra la duracion de extremo a extremo de la linea en curso
+     */
+    void terminarLinea() {
+        if (inicioLinea != 0) {
+            registrar(ETAPA_TOTAL, inicioLinea);
+            inicioLinea = 0;
+        }
+    }
+    
+    const HistogramaLatencia& getEtapa(EtapaIngesta etapa) const { return etapas[etapa]; }
+    uint64_t getContador(ContadorIngesta contador) const {
+        return contadores[contador].load(std::memory_order_relaxed);
+    }
+    
+    /**
+     * @brief Nombre de una etapa para los informes
+     */
+    static const char* nombreEtapa(int etapa) {
+        static const char* nombres[CANTIDAD_ETAPAS] = {
+            "lectura", "parseo", "busqueda", "insercion", "agregacion", "alertas", "total"
+        };
+        return nombres[etapa];
+    }
+    
+    /**
+     * @brief Nombre de un contador para los informes
+     */
+    static const char* nombreContador(int contador) {
+        static const char* nombres[CANTIDAD_CONTADORES] = {
+            "lineas", "lineas_sistema", "errores_parseo", "descartes", "errores_lectura"
+        };
+        return nombres[contador];
+    }
+    
+    /**
+     * @brief Escribe contadores y percentiles de cada etapa
+     * @param salida Flujo de destino
+     */
+    void exportar(std::ostream& salida) const {
+        std::ostringstream informe;
+        informe << "[INSTRUMENTACION] contadores:";
+        for (int i = 0; i < CANTIDAD_CONTADORES; i++) {
+            informe << " " << nombreContador(i) << "=" << getContador(static_cast<ContadorIngesta>(i));
+        }
+        informe << "\n[INSTRUMENTACION] " << std::left << std::setw(11) << "etapa" << std::right
+                << std::setw(10) << "muestras" << std::setw(10) << "media_ns" << std::setw(10) << "p50_ns"
+                << std::setw(10) << "p90_ns" << std::setw(10) << "p99_ns" << std::setw(10) << "p999_ns"
+                << std::setw(12) << "max_ns" << "\n";
+        for (int i = 0; i < CANTIDAD_ETAPAS; i++) {
+            const HistogramaLatencia& h = etapas[i];
+            informe << "[INSTRUMENTACION] " << std::left << std::setw(11) << nombreEtapa(i) << std::right
+                    << std::setw(10) << h.getCantidad()
+                    << std::setw(10) << std::fixed << std::setprecision(0) << h.getMedia()
+                    << std::setw(10) << h.percentil(0.50) << std::setw(10) << h.percentil(0.90)
+                    << std::setw(10) << h.percentil(0.99) << std::setw(10) << h.percentil(0.999)
+                    << std::setw(12) << h.getMaximo() << "\n";
+        }
+        salida << informe.str() << std::flush;
+    }
+    
+    /**
+     * @brief Escribe contadores y percentiles en formato de texto de Prometheus
+     * @param salida Flujo de destino
+     * 
+     * Cada etapa se publica como un resumen (summary) en segundos; los
+     * percentiles se leen del histograma sin detener la ingesta.
+     */
+    void exportarPrometheus(std::ostream& salida) const {
+        salida << "# HELP sensores_ingesta_eventos_total Eventos contados en la ruta de ingesta\n"
+               << "# TYPE sensores_ingesta_eventos_total counter\n";
+        for (int i = 0; i < CANTIDAD_CONTADORES; i++) {
+            salida << "sensores_ingesta_eventos_total{evento=\"" << nombreContador(i) << "\"} "
+                   << getContador(static_cast<ContadorIngesta>(i)) << "\n";
+        }
+        
+        const double cuantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+        salida << "# HELP sensores_ingesta_latencia_segundos Latencia por etapa de la ruta de ingesta\n"
+               << "# TYPE sensores_ingesta_latencia_segundos summary\n";
+        for (int i = 0; i < CANTIDAD_ETAPAS; i++) {
+            const HistogramaLatencia& h = etapas[i];
+            for (int c = 0; c < 4; c++) {
+                salida << "sensores_ingesta_latencia_segundos{etapa=\"" << nombreEtapa(i)
+                       << "\",quantile=\"" << cuantiles[c] << "\"} " << h.percentil(cuantiles[c]) * 1e-9 << "\n";
+            }
+            salida << "sensores_ingesta_latencia_segundos_sum{etapa=\"" << nombreEtapa(i) << "\"} "
+                   << h.getSuma() * 1e-9 << "\n"
+                   << "sensores_ingesta_latencia_segundos_count{etapa=\"" << nombreEtapa(i) << "\"} "
+                   << h.getCantidad() << "\n";
+        }
+    }
+};
+
+/**
+ * @class ExportadorInstrumentacion
+ * @brief Hilo que publica el informe de instrumentacion al recibir SIGUSR1
+ * 
+ * El manejador de la senal solo activa un indicador; el hilo lo revisa
+ * cada 100 ms y escribe el informe en la salida de errores, sin
+ * interrumpir la lectura del puerto. El hilo se detiene en el destructor.
+ */
+class ExportadorInstrumentacion {
+private:
+    std::atomic<bool> activo;  ///< Indicador de continuidad del hilo
+    std::thread hilo;          ///< Hilo exportador
+    
+    static volatile std::sig_atomic_t& solicitud() {
+        static volatile std::sig_atomic_t pendiente = 0;
+        return pendiente;
+    }
+    
+    static void recibirSenal(int) {
+        solicitud() = 1;
+    }
+    
+    void ejecutar() {
+        while (activo.load(std::memory_order_acquire)) {
+            if (solicitud() != 0) {
+                solicitud() = 0;
+                Instrumentacion::global().exportar(std::cerr);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+    
+public:
+    ExportadorInstrumentacion() : activo(true), hilo(&ExportadorInstrumentacion::ejecutar, this) {
+        std::signal(SIGUSR1, &ExportadorInstrumentacion::recibirSenal);
+    }
+    
+    ExportadorInstrumentacion(const ExportadorInstrumentacion&) = delete;
+    ExportadorInstrumentacion& operator=(const ExportadorInstrumentacion&) = delete;
+    
+    ~ExportadorInstrumentacion() {
+        std::signal(SIGUSR1, SIG_DFL);
+        activo.store(false, std::memory_order_release);
+        hilo.join();
+    }
+};
+
+#ifdef SENSORES_INSTRUMENTACION
+/// Declara una marca de tiempo para medir etapas a partir de este punto
+#define INSTRUMENTO_MARCA(marca) uint64_t marca = Instrumentacion::ahora()
+/// Registra la etapa que termina aqui y reinicia la marca para la siguiente
+#define INSTRUMENTO_ETAPA(etapa, marca) marca = Instrumentacion::global().registrar(etapa, marca)
+/// Reinicia una marca sin registrar el tramo transcurrido
+#define INSTRUMENTO_REINICIAR(marca) marca = Instrumentacion::ahora()
+/// Incrementa un contador de eventos
+#define INSTRUMENTO_CONTAR(contador) Instrumentacion::global().contar(contador)
+/// Marca la llegada del primer byte de una linea
+#define INSTRUMENTO_INICIAR_LINEA() Instrumentacion::global().iniciarLinea(Instrumentacion::ahora())
+/// Registra el tramo de lectura de la linea
+#define INSTRUMENTO_TERMINAR_LECTURA() Instrumentacion::global().terminarLectura()
+/// Registra la latencia de extremo a extremo de la linea
+#define INSTRUMENTO_TERMINAR_LINEA() Instrumentacion::global().terminarLinea()
+/// Publica el informe al recibir SIGUSR1 durante el alcance de la declaracion
+#define INSTRUMENTO_EXPORTADOR(nombre) ExportadorInstrumentacion nombre
+#else
+#define INSTRUMENTO_MARCA(marca) ((void)0)
+#define INSTRUMENTO_ETAPA(etapa, marca) ((void)0)
+#define INSTRUMENTO_REINICIAR(marca) ((void)0)
+#define INSTRUMENTO_CONTAR(contador) ((void)0)
+#define INSTRUMENTO_INICIAR_LINEA() ((void)0)
+#define INSTRUMENTO_TERMINAR_LECTURA() ((void)0)
+#define INSTRUMENTO_TERMINAR_LINEA() ((void)0)
+#define INSTRUMENTO_EXPORTADOR(nombre) ((void)0)
+#endif
+
+#endif // INSTRUMENTACION_H
@@ -0,0 +1,294 @@
+/**
+ * @file ListaConcurrente.h
+ * @brief Lista enlazada de un escritor y multiples lectores sin cerrojos
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef LISTACONCURRENTE_H
+#define LISTACONCURRENTE_H
+
+#include "ReclamacionEpocas.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct NodoConcurrente
+ * @brief Nodo cuyo enlace se publica con orden adquisicion/liberacion
+ */
+template <typename T>
+struct NodoConcurrente {
+    T dato;                                     ///< Valor almacenado (inmutable una vez publicado)
+    unsigned long long secuencia;               ///< Orden de alta, creciente en la lista (inmutable)
+    std::atomic<NodoConcurrente<T>*> siguiente;  ///< Enlace al nodo posterior
+    
+    NodoConcurrente(const T& valor, unsigned long long orden)
+        : dato(valor), secuencia(orden), siguiente(nullptr) {}
+};
+
+/**
+ * @class ListaConcurrente
+ * @brief Variante de ListaSensor para un hilo escritor y lectores concurrentes
+ * 
+ * El escritor (el bucle de captura) agrega y retira elementos sin esperar
+ * a nadie; los lectores (paneles, exportadores) recorren la lista sin
+ * cerrojos mientras la captura avanza.
+ * 
+ * - Agregar construye el nodo completo y lo enlaza con una escritura de
+ *   liberacion; un lector que lo alcanza con una lectura de adquisicion
+ *   ve su valor ya inicializado.
+ * - Cada nodo recibe al agregarse un numero de secuencia creciente. Cada
+ *   lectura toma al empezar la secuencia de la cola publicada y luego la
+ *   cabeza, y se detiene en el primer nodo con secuencia mayor: lo
+ *   agregado despues no se recorre, aunque el escritor haya retirado la
+ *   cola de la instantanea y enlazado nodos nuevos en su lugar. Como un
+ *   nodo retirado conserva su enlace, si el escritor retira por el frente
+ *   durante el recorrido la lectura ve igualmente un tramo contiguo, sin
+ *   huecos ni duplicados.
+ * - Los nodos retirados no se liberan de inmediato: se asocian a la epoca
+ *   global vigente y se liberan cuando todos los lectores activos
+ *   comenzaron en una epoca posterior (ver DominioEpocas).
+ * 
+ * Admite hasta MAX_LECTORES lecturas simultaneas; una lectura adicional
+ * cede el procesador hasta que se libere un lugar.
+ * 
+ * @tparam T Tipo de los elementos (copiable)
+ */
+template <typename T>
+class ListaConcurrente {
+public:
+    static const int MAX_LECTORES = DominioEpocas::MAX_PARTICIPANTES;  ///< Lecturas simultaneas admitidas
+    
+private:
+    static const std::size_t UMBRAL_RECOLECCION = 64;  ///< Retirados que disparan la primera recoleccion
+    
+    /**
+     * @struct NodoRetirado
+     * @brief Nodo desenlazado pendiente de liberar
+     */
+    struct NodoRetirado {
+        NodoConcurrente<T>* nodo;  ///< Nodo fuera de la lista
+        unsigned long long epoca;  ///< Epoca global al retirarlo
+    };
+    
+    std::atomic<NodoConcurrente<T>*> primero;        ///< Cabeza publicada
+    std::atomic<NodoConcurrente<T>*> colaPublicada;  ///< Ultimo nodo visible para los lectores
+    std::atomic<int> elementos;                      ///< Cantidad publicada
+    NodoConcurrente<T>* ultimo;                      ///< Cola (solo el escritor)
+    unsigned long long proximaSecuencia;             ///< Secuencia del proximo nodo (solo el escritor)
+    std::vector<NodoRetirado> retirados;             ///< Pendientes de liberar (solo el escritor)
+    std::size_t umbralRecoleccion;                   ///< Retirados que disparan la proxima recoleccion
+    
+    mutable DominioEpocas epocas;                    ///< Epocas anunciadas por las lecturas
+    
+    ListaConcurrente(const ListaConcurrente&);
+    ListaConcurrente& operator=(const ListaConcurrente&);
+    
+    /**
+     * @brief Aparta un nodo desenlazado hasta que ningun lector pueda alcanzarlo
+     */
+    void retirar(NodoConcurrente<T>* nodo) {
+        NodoRetirado pendiente;
+        pendiente.nodo = nodo;
+        pendiente.epoca = epocas.retirar();
+        retirados.push_back(pendiente);
+        elementos.fetch_sub(1, std::memory_order_release);
+        if (retirados.size() >= umbralRecoleccion) {
+            recolectar();
+        }
+    }
+    
+public:
+    /**
+     * @class Lectura
+     * @brief Recorrido protegido de la lista (RAII)
+     * 
+     * Mientras exista, ningun nodo alcanzable desde la lectura se libera.
+     * Debe vivir poco: una lectura prolongada retiene la memoria de todo
+     * lo que el escritor retire mientras tanto.
+     */
+    class Lectura {
+    private:
+        DominioEpocas::Guarda guarda;  ///< Epoca anunciada durante el recorrido
+        unsigned long long limite;     ///< Secuencia de la cola al comenzar (0 si estaba vacia)
+        NodoConcurrente<T>* inicio;    ///< Cabeza al comenzar
+        int cantidad;                  ///< Cantidad publicada al comenzar
+        
+        Lectura(const Lectura&);
+        Lectura& operator=(const Lectura&);
+        
+        static unsigned long long secuenciaDe(const NodoConcurrente<T>* nodo) {
+            return nodo == nullptr ? 0 : nodo->secuencia;
+        }
+        
+    public:
+        explicit Lectura(const ListaConcurrente& origen)
+            : guarda(origen.epocas),
+              limite(secuenciaDe(origen.colaPublicada.load(std::memory_order_acquire))),
+              inicio(origen.primero.load(std::memory_order_acquire)),
+              cantidad(origen.elementos.load(std::memory_order_acquire)) {}
+        
+        /**
+         * @brief Cantidad publicada al comenzar la lectura
+         * 
+         * Si el escritor retira elementos durante el recorrido, iterar
+         * puede visitar menos.
+         */
+        int getTamanio() const { return cantidad; }
+        
+        /**
+         * @brief Recorre la instantanea aplicando una operacion a cada elemento
+         * @tparam Operacion Invocable con firma void(const T&)
+         * @return Elementos visitados
+         */
+        template <typename Operacion>
+        int iterar(Operacion operacion) const {
+            int visitados = 0;
+            for (NodoConcurrente<T>* nodo = inicio; nodo != nullptr && nodo->secuencia <= limite;
+                 nodo = nodo->siguiente.load(std::memory_order_acquire)) {
+                operacion(nodo->dato);
+                visitados++;
+            }
+            return visitados;
+        }
+    };
+    
+    ListaConcurrente()
+        : primero(nullptr), colaPublicada(nullptr), elementos(0), ultimo(nullptr), proximaSecuencia(1),
+          umbralRecoleccion(UMBRAL_RECOLECCION) {}
+    
+    /**
+     * @brief Destructor; no debe haber lecturas en curso
+     */
+    ~ListaConcurrente() {
+        NodoConcurrente<T>* nodo = primero.load(std::memory_order_relaxed);
+        while (nodo != nullptr) {
+            NodoConcurrente<T>* siguiente = nodo->siguiente.load(std::memory_order_relaxed);
+            delete nodo;
+            nodo = siguiente;
+        }
+        for (std::size_t i = 0; i < retirados.size(); i++) {
+            delete retirados[i].nodo;
+        }
+    }
+    
+    /**
+     * @brief Agrega un elemento al final (solo el escritor)
+     */
+    void insertarAlFinal(const T& valor) {
+        NodoConcurrente<T>* nuevo = new NodoConcurrente<T>(valor, proximaSecuencia++);
+        if (ultimo == nullptr) {
+            primero.store(nuevo, std::memory_order_release);
+        } else {
+            ultimo->siguiente.store(nuevo, std::memory_order_release);
+        }
+        ultimo = nuevo;
+        colaPublicada.store(nuevo, std::memory_order_release);
+        elementos.fetch_add(1, std::memory_order_release);
+    }
+    
+    /**
+     * @brief Retira el elemento mas antiguo (solo el escritor)
+     * @return false si la lista estaba vacia
+     */
+    bool eliminarPrimero() {
+        NodoConcurrente<T>* retirado = primero.load(std::memory_order_relaxed);
+        if (retirado == nullptr) {
+            return false;
+        }
+        NodoConcurrente<T>* siguiente = retirado->siguiente.load(std::memory_order_relaxed);
+        if (siguiente == nullptr) {
+            ultimo = nullptr;
+            colaPublicada.store(nullptr, std::memory_order_release);
+        }
+        primero.store(siguiente, std::memory_order_release);
+        retirar(retirado);
+        return true;
+    }
+    
+    /**
+     * @brief Retira los elementos que cumplen un predicado (solo el escritor)
+     * @tparam Predicado Invocable con firma bool(const T&)
+     * @return Cantidad de elementos retirados
+     */
+    template <typename Predicado>
+    int eliminarSi(Predicado predicado) {
+        int eliminados = 0;
+        NodoConcurrente<T>* anterior = nullptr;
+        NodoConcurrente<T>* nodo = primero.load(std::memory_order_relaxed);
+        while (nodo != nullptr) {
+            NodoConcurrente<T>* siguiente = nodo->siguiente.load(std::memory_order_relaxed);
+            if (!predicado(nodo->dato)) {
+                anterior = nodo;
+                nodo = siguiente;
+                continue;
+            }
+            if (nodo == ultimo) {
+                ultimo = anterior;
+                colaPublicada.store(anterior, std::memory_order_release);
+            }
+            if (anterior == nullptr) {
+                primero.store(siguiente, std::memory_order_release);
+            } else {
+                anterior->siguiente.store(siguiente, std::memory_order_release);
+            }
+            retirar(nodo);
+            eliminados++;
+            nodo = siguiente;
+        }
+        return eliminados;
+    }
+    
+    /**
+     * @brief Libera los nodos retirados que ya ningun lector puede alcanzar
+     * @return Nodos liberados
+     * 
+     * Lo invoca el escritor. retirar lo llama cuando los pendientes alcanzan
+     * un umbral que se recalcula en cada recoleccion como el doble de los
+     * que sobreviven (y al menos UMBRAL_RECOLECCION): si un lector retiene
+     * su epoca, los pendientes se acumulan sin que cada baja vuelva a
+     * recorrerlos, y el costo de recolectar queda amortizado en O(1).
+     */
+    std::size_t recolectar() {
+        const unsigned long long minima = epocas.epocaSegura();
+        std::size_t conservados = 0;
+        for (std::size_t i = 0; i < retirados.size(); i++) {
+            if (retirados[i].epoca < minima) {
+                delete retirados[i].nodo;
+            } else {
+                retirados[conservados++] = retirados[i];
+            }
+        }
+        const std::size_t liberados = retirados.size() - conservados;
+        retirados.resize(conservados);
+        const std::size_t minimo = UMBRAL_RECOLECCION;
+        umbralRecoleccion = std::max(minimo, 2 * conservados);
+        return liberados;
+    }
+    
+    /**
+     * @brief Cantidad publicada; puede consultarse desde cualquier hilo
+     */
+    int getTamanio() const { return elementos.load(std::memory_order_acquire); }
+    
+    /**
+     * @brief Nodos retirados que aun esperan a algun lector (solo el escritor)
+     */
+    std::size_t getPendientes() const { return retirados.size(); }
+    
+    /**
+     * @brief Recorre la lista dentro de una lectura protegida
+     * @tparam Operacion Invocable con firma void(const T&)
+     * @return Elementos visitados
+     */
+    template <typename Operacion>
+    int iterar(Operacion operacion) const {
+        Lectura lectura(*this);
+        return lectura.iterar(operacion);
+    }
+};
+
+#endif // LISTACONCURRENTE_H
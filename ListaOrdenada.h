@@ -0,0 +1,362 @@
+/**
+ * @file ListaOrdenada.h
+ * @brief Lista enlazada ordenada con busqueda por niveles (skip list)
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef LISTAORDENADA_H
+#define LISTAORDENADA_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <new>
+
+/**
+ * @struct NodoSalto
+ * @brief Nodo de la lista ordenada con un enlace por nivel
+ * 
+ * Es un Nodo cuyo campo siguiente se extiende a varios niveles: el nivel
+ * 0 enlaza todos los elementos en orden y cada nivel superior enlaza un
+ * subconjunto cada vez mas disperso, que permite saltar tramos enteros.
+ * Los enlaces se ubican a continuacion del nodo, en la misma asignacion,
+ * de modo que cada nodo ocupa solo los niveles que le tocaron.
+ * 
+ * @tparam T Tipo de dato que almacenara el nodo
+ */
+template <typename T>
+struct NodoSalto {
+    T dato;                    ///< Contenido almacenado en el elemento
+    int niveles;               ///< Cantidad de enlaces del nodo
+    NodoSalto<T>** siguiente;  ///< Enlaces por nivel; siguiente[0] es el proximo elemento
+    
+    /**
+     * @brief Crea un nodo con sus enlaces en una unica asignacion
+     * @param contenido Valor a almacenar
+     * @param cantidadNiveles Niveles del nodo (al menos 1)
+     */
+    static NodoSalto<T>* crear(const T& contenido, int cantidadNiveles) {
+        void* espacio = ::operator new(sizeof(NodoSalto<T>) +
+                                       static_cast<std::size_t>(cantidadNiveles) * sizeof(NodoSalto<T>*));
+        NodoSalto<T>** enlaces = reinterpret_cast<NodoSalto<T>**>(static_cast<char*>(espacio) + sizeof(NodoSalto<T>));
+        for (int i = 0; i < cantidadNiveles; i++) {
+            enlaces[i] = nullptr;
+        }
+        return new (espacio) NodoSalto<T>(contenido, cantidadNiveles, enlaces);
+    }
+    
+    /**
+     * @brief Libera un nodo obtenido con crear()
+     */
+    static void destruir(NodoSalto<T>* nodo) {
+        nodo->~NodoSalto<T>();
+        ::operator delete(nodo);
+    }
+    
+private:
+    NodoSalto(const T& contenido, int cantidadNiveles, NodoSalto<T>** enlaces)
+        : dato(contenido), niveles(cantidadNiveles), siguiente(enlaces) {}
+};
+
+/**
+ * @class ListaOrdenada
+ * @brief Variante ordenada de ListaSensor con insercion y busqueda en O(log n) esperado
+ * 
+ * Mantiene los elementos ordenados segun Comparador y los enlaza en varios
+ * niveles: cada nodo participa del nivel i+1 con probabilidad 1/4, por lo
+ * que una busqueda desciende desde el nivel mas alto saltando tramos y
+ * recorre en promedio unos pocos nodos por nivel.
+ * 
+ * Las busquedas aceptan claves de otro tipo si el comparador admite ambas
+ * combinaciones (elemento, clave) y (clave, elemento); asi un indice de
+ * sensores se consulta directamente con un nombre o un identificador.
+ * Los elementos iguales se conservan en orden de insercion.
+ * 
+ * El recorrido es siempre en orden y solo de lectura: modificar un
+ * elemento en su lugar podria romper el orden.
+ * 
+ * @tparam T Tipo de dato almacenado
+ * @tparam Comparador Orden estricto debil, como std::less
+ */
+template <typename T, typename Comparador = std::less<T> >
+class ListaOrdenada {
+public:
+    static const int MAX_NIVELES = 16;  ///< Suficiente para ~4^16 elementos
+    
+private:
+    NodoSalto<T>* cabecera[MAX_NIVELES];  ///< Primer nodo de cada nivel
+    int nivelesActivos;                   ///< Niveles con al menos un nodo (minimo 1)
+    int elementos;                        ///< Cantidad de elementos
+    long long enlacesTotales;             ///< Suma de niveles de todos los nodos
+    unsigned int semilla;                 ///< Estado del generador de niveles
+    Comparador comparador;                ///< Criterio de orden
+    
+    ListaOrdenada(const ListaOrdenada&);
+    ListaOrdenada& operator=(const ListaOrdenada&);
+    
+    /**
+     * @brief Sortea los niveles de un nodo nuevo (xorshift de 32 bits)
+     * 
+     * Cada par de bits en cero agrega un nivel: probabilidad 1/4.
+     */
+    int sortearNiveles() {
+        semilla ^= semilla << 13;
+        semilla ^= semilla >> 17;
+        semilla ^= semilla << 5;
+        unsigned int bits = semilla;
+        int niveles = 1;
+        while (niveles < MAX_NIVELES && (bits & 3u) == 0) {
+            niveles++;
+            bits >>= 2;
+        }
+        return niveles;
+    }
+    
+    /**
+     * @brief Desciende hasta el ultimo nodo anterior a la clave en cada nivel
+     * @param clave Clave de referencia
+     * @param previos Si no es nulo, recibe los enlaces a modificar por nivel
+     * @return Primer nodo que no es menor que la clave (nullptr si no hay)
+     */
+    template <typename Clave>
+    NodoSalto<T>* descenderInferior(const Clave& clave, NodoSalto<T>** previos[]) const {
+        NodoSalto<T>* const* enlaces = cabecera;
+        for (int nivel = nivelesActivos - 1; nivel >= 0; nivel--) {
+            while (enlaces[nivel] != nullptr && comparador(enlaces[nivel]->dato, clave)) {
+                enlaces = enlaces[nivel]->siguiente;
+            }
+            if (previos != nullptr) {
+                previos[nivel] = const_cast<NodoSalto<T>**>(enlaces);
+            }
+        }
+        return enlaces[0];
+    }
+    
+    /**
+     * @brief Primer nodo mayor que la clave
+     */
+    template <typename Clave>
+    NodoSalto<T>* descenderSuperior(const Clave& clave, NodoSalto<T>** previos[]) const {
+        NodoSalto<T>* const* enlaces = cabecera;
+        for (int nivel = nivelesActivos - 1; nivel >= 0; nivel--) {
+            while (enlaces[nivel] != nullptr && !comparador(clave, enlaces[nivel]->dato)) {
+                enlaces = enlaces[nivel]->siguiente;
+            }
+            if (previos != nullptr) {
+                previos[nivel] = const_cast<NodoSalto<T>**>(enlaces);
+            }
+        }
+        return enlaces[0];
+    }
+    
+public:
+    /**
+     * @class IteradorConstante
+     * @brief Iterador de avance sobre el nivel 0, en orden
+     */
+    class IteradorConstante {
+    private:
+        const NodoSalto<T>* actual;  ///< Nodo apuntado (nullptr = fin)
+        
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+        
+        explicit IteradorConstante(const NodoSalto<T>* nodo = nullptr) : actual(nodo) {}
+        
+        reference operator*() const { return actual->dato; }
+        pointer operator->() const { return &actual->dato; }
+        
+        IteradorConstante& operator++() {
+            actual = actual->siguiente[0];
+            return *this;
+        }
+        
+        IteradorConstante operator++(int) {
+            IteradorConstante previo(*this);
+            actual = actual->siguiente[0];
+            return previo;
+        }
+        
+        friend bool operator==(const IteradorConstante& a, const IteradorConstante& b) {
+            return a.actual == b.actual;
+        }
+        
+        friend bool operator!=(const IteradorConstante& a, const IteradorConstante& b) {
+            return a.actual != b.actual;
+        }
+    };
+    
+    typedef IteradorConstante const_iterator;
+    typedef IteradorConstante iterator;
+    typedef T value_type;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    
+    /**
+     * @brief Constructor
+     * @param criterio Comparador a utilizar
+     */
+    explicit ListaOrdenada(const Comparador& criterio = Comparador())
+        : nivelesActivos(1), elementos(0), enlacesTotales(0), semilla(2463534242u), comparador(criterio) {
+        for (int i = 0; i < MAX_NIVELES; i++) {
+            cabecera[i] = nullptr;
+        }
+    }
+    
+    ~ListaOrdenada() {
+        vaciar();
+    }
+    
+    /**
+     * @brief Inserta un elemento en su posicion, despues de los iguales
+     * @param contenido Valor a insertar
+     * @return Nodo creado
+     */
+    NodoSalto<T>* insertar(const T& contenido) {
+        NodoSalto<T>** previos[MAX_NIVELES];
+        descenderSuperior(contenido, previos);
+        const int niveles = sortearNiveles();
+        for (int nivel = nivelesActivos; nivel < niveles; nivel++) {
+            previos[nivel] = cabecera;
+        }
+        if (niveles > nivelesActivos) {
+            nivelesActivos = niveles;
+        }
+        NodoSalto<T>* nuevo = NodoSalto<T>::crear(contenido, niveles);
+        for (int nivel = 0; nivel < niveles; nivel++) {
+            nuevo->siguiente[nivel] = previos[nivel][nivel];
+            previos[nivel][nivel] = nuevo;
+        }
+        elementos++;
+        enlacesTotales += niveles;
+        return nuevo;
+    }
+    
+    /**
+     * @brief Primer elemento que no es menor que la clave (lower_bound)
+     * @return Nodo encontrado o nullptr si todos son menores
+     */
+    template <typename Clave>
+    NodoSalto<T>* limiteInferior(const Clave& clave) const {
+        return descenderInferior(clave, nullptr);
+    }
+    
+    /**
+     * @brief Primer elemento mayor que la clave (upper_bound)
+     * @return Nodo encontrado o nullptr si ninguno es mayor
+     */
+    template <typename Clave>
+    NodoSalto<T>* limiteSuperior(const Clave& clave) const {
+        return descenderSuperior(clave, nullptr);
+    }
+    
+    /**
+     * @brief Busca el primer elemento equivalente a la clave
+     * @return Nodo encontrado o nullptr
+     */
+    template <typename Clave>
+    NodoSalto<T>* buscar(const Clave& clave) const {
+        NodoSalto<T>* candidato = descenderInferior(clave, nullptr);
+        if (candidato == nullptr || comparador(clave, candidato->dato)) {
+            return nullptr;
+        }
+        return candidato;
+    }
+    
+    /**
+     * @brief Retira el primer elemento equivalente a la clave
+     * @return true si habia un elemento equivalente
+     */
+    template <typename Clave>
+    bool eliminar(const Clave& clave) {
+        NodoSalto<T>** previos[MAX_NIVELES];
+        NodoSalto<T>* retirado = descenderInferior(clave, previos);
+        if (retirado == nullptr || comparador(clave, retirado->dato)) {
+            return false;
+        }
+        for (int nivel = 0; nivel < retirado->niveles; nivel++) {
+            previos[nivel][nivel] = retirado->siguiente[nivel];
+        }
+        while (nivelesActivos > 1 && cabecera[nivelesActivos - 1] == nullptr) {
+            nivelesActivos--;
+        }
+        elementos--;
+        enlacesTotales -= retirado->niveles;
+        NodoSalto<T>::destruir(retirado);
+        return true;
+    }
+    
+    /**
+     * @brief Aplica una operacion a los elementos en [desde, hasta)
+     * @tparam Operacion Invocable con firma void(const T&)
+     * @return Cantidad de elementos visitados
+     */
+    template <typename Clave, typename Operacion>
+    int iterarRango(const Clave& desde, const Clave& hasta, Operacion operacion) const {
+        int visitados = 0;
+        for (const NodoSalto<T>* nodo = descenderInferior(desde, nullptr);
+             nodo != nullptr && comparador(nodo->dato, hasta); nodo = nodo->siguiente[0]) {
+            operacion(nodo->dato);
+            visitados++;
+        }
+        return visitados;
+    }
+    
+    /**
+     * @brief Aplica una operacion a todos los elementos, en orden
+     * @tparam Operacion Invocable con firma void(const T&)
+     */
+    template <typename Operacion>
+    void iterar(Operacion operacion) const {
+        for (const NodoSalto<T>* nodo = cabecera[0]; nodo != nullptr; nodo = nodo->siguiente[0]) {
+            operacion(nodo->dato);
+        }
+    }
+    
+    /**
+     * @brief Libera todos los nodos
+     */
+    void vaciar() {
+        NodoSalto<T>* nodo = cabecera[0];
+        while (nodo != nullptr) {
+            NodoSalto<T>* siguiente = nodo->siguiente[0];
+            NodoSalto<T>::destruir(nodo);
+            nodo = siguiente;
+        }
+        for (int i = 0; i < MAX_NIVELES; i++) {
+            cabecera[i] = nullptr;
+        }
+        nivelesActivos = 1;
+        elementos = 0;
+        enlacesTotales = 0;
+    }
+    
+    const_iterator begin() const { return const_iterator(cabecera[0]); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    
+    int getTamanio() const { return elementos; }
+    bool estaVacia() const { return elementos == 0; }
+    
+    /**
+     * @brief Niveles en uso; crece como log4 de la cantidad de elementos
+     */
+    int getNivelesActivos() const { return nivelesActivos; }
+    
+    /**
+     * @brief Bytes ocupados por los nodos y sus enlaces
+     */
+    std::size_t bytesOcupados() const {
+        return static_cast<std::size_t>(elementos) * sizeof(NodoSalto<T>) +
+               static_cast<std::size_t>(enlacesTotales) * sizeof(NodoSalto<T>*);
+    }
+};
+
+#endif // LISTAORDENADA_H
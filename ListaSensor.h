@@ -10,7 +10,25 @@
 #define LISTASENSOR_H
 
 #include "Nodo.h"
+#include "Bitacora.h"
 #include <iostream>
+#include <iterator>
+#include <typeinfo>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @enum PoliticaBusqueda
+ * @brief Estrategia de ListaSensor::buscarSi para busquedas repetidas
+ */
+enum PoliticaBusqueda {
+    BUSQUEDA_SECUENCIAL,       ///< Recorrido desde el inicio en cada busqueda
+    BUSQUEDA_ULTIMO_ACIERTO,   ///< Se prueba primero el ultimo nodo encontrado
+    BUSQUEDA_MOVER_AL_FRENTE   ///< Ademas, el nodo encontrado pasa al inicio de la lista
+};
 
 /**
  * @class ListaSensor
@@ -19,6 +37,20 @@
  * Implementa una lista enlazada simple que puede almacenar cualquier tipo de dato.
  * Proporciona operaciones fundamentales de insercion, busqueda, iteracion y liberacion.
  * Cumple con la Regla de los Tres para gestion correcta de memoria dinamica.
+ * Lleva la cuenta de los nodos vivos y de su maximo, de modo que la memoria
+ * de la lista se conoce sin recorrerla.
+ * 
+ * Los elementos se retiran de a uno en tiempo constante (eliminarPrimero,
+ * eliminarDespuesDe) o con una sola pasada (eliminar, eliminarSi).
+ * 
+ * Ofrece iteradores de avance (begin/end, mutables y constantes), de modo
+ * que la lista admite el for por rango y los algoritmos de la biblioteca
+ * estandar, incluidos los que terminan al encontrar un elemento.
+ * 
+ * buscarSi admite una politica para flujos donde los mismos elementos se
+ * buscan una y otra vez: recordar el ultimo acierto o mover cada acierto
+ * al frente, de modo que los elementos frecuentes se encuentran en pocos
+ * pasos sin un indice adicional.
  * 
  * @tparam T Tipo de dato que almacenara la lista
  */
@@ -26,16 +58,114 @@ template <typename T>
 class ListaSensor {
 private:
     Nodo<T>* primero;  ///< Referencia al elemento inicial de la lista
+    Nodo<T>* ultimo;   ///< Referencia al elemento final de la lista
     int elementos;     ///< Contador de elementos presentes en la lista
+    int picoElementos; ///< Mayor cantidad de elementos simultaneos
+    PoliticaBusqueda politica;        ///< Estrategia de buscarSi
+    mutable Nodo<T>* ultimoAcierto;   ///< Ultimo nodo devuelto por buscarSi (nullptr si no hay)
     
 public:
+    /**
+     * @class Iterador
+     * @brief Iterador de avance que permite modificar los elementos
+     */
+    class Iterador {
+    private:
+        Nodo<T>* actual;  ///< Nodo apuntado (nullptr al final)
+        
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+        
+        Iterador() : actual(nullptr) {}
+        explicit Iterador(Nodo<T>* nodo) : actual(nodo) {}
+        
+        reference operator*() const { return actual->dato; }
+        pointer operator->() const { return &actual->dato; }
+        
+        Iterador& operator++() {
+            actual = actual->siguiente;
+            return *this;
+        }
+        
+        Iterador operator++(int) {
+            Iterador previo(*this);
+            actual = actual->siguiente;
+            return previo;
+        }
+        
+        bool operator==(const Iterador& otro) const { return actual == otro.actual; }
+        bool operator!=(const Iterador& otro) const { return actual != otro.actual; }
+        
+        Nodo<T>* getNodo() const { return actual; }
+    };
+    
+    /**
+     * @class IteradorConstante
+     * @brief Iterador de avance de solo lectura
+     * 
+     * Se construye implicitamente a partir de un Iterador, de modo que
+     * ambos pueden compararse entre si.
+     */
+    class IteradorConstante {
+    private:
+        const Nodo<T>* actual;  ///< Nodo apuntado (nullptr al final)
+        
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+        
+        IteradorConstante() : actual(nullptr) {}
+        explicit IteradorConstante(const Nodo<T>* nodo) : actual(nodo) {}
+        IteradorConstante(const Iterador& otro) : actual(otro.getNodo()) {}
+        
+        reference operator*() const { return actual->dato; }
+        pointer operator->() const { return &actual->dato; }
+        
+        IteradorConstante& operator++() {
+            actual = actual->siguiente;
+            return *this;
+        }
+        
+        IteradorConstante operator++(int) {
+            IteradorConstante previo(*this);
+            actual = actual->siguiente;
+            return previo;
+        }
+        
+        friend bool operator==(const IteradorConstante& a, const IteradorConstante& b) {
+            return a.actual == b.actual;
+        }
+        friend bool operator!=(const IteradorConstante& a, const IteradorConstante& b) {
+            return a.actual != b.actual;
+        }
+    };
+    
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef Iterador iterator;
+    typedef IteradorConstante const_iterator;
+    typedef std::ptrdiff_t difference_type;
+    typedef std::size_t size_type;
+    
     /**
      * @brief Constructor predeterminado
      * 
      * Inicializa una lista vacia con puntero nulo y contador en cero.
      */
-    ListaSensor() : primero(nullptr), elementos(0) {
-        std::cout << "[Inicializacion] Estructura de lista creada" << std::endl;
+    ListaSensor()
+        : primero(nullptr), ultimo(nullptr), elementos(0), picoElementos(0),
+          politica(BUSQUEDA_SECUENCIAL), ultimoAcierto(nullptr) {
+        if (Bitacora::activa()) {
+            std::cout << "[Inicializacion] Estructura de lista creada" << std::endl;
+        }
     }
     
     /**
@@ -44,8 +174,12 @@ public:
      * 
      * Crea una copia profunda de otra lista, duplicando todos sus elementos.
      */
-    ListaSensor(const ListaSensor& origen) : primero(nullptr), elementos(0) {
-        std::cout << "[Duplicacion] Proceso de copia iniciado" << std::endl;
+    ListaSensor(const ListaSensor& origen)
+        : primero(nullptr), ultimo(nullptr), elementos(0), picoElementos(0),
+          politica(origen.politica), ultimoAcierto(nullptr) {
+        if (Bitacora::activa()) {
+            std::cout << "[Duplicacion] Proceso de copia iniciado" << std::endl;
+        }
         duplicarDesde(origen);
     }
     
@@ -58,7 +192,9 @@ public:
      * cualquier contenido previo.
      */
     ListaSensor& operator=(const ListaSensor& origen) {
-        std::cout << "[Asignacion] Operador de copia invocado" << std::endl;
+        if (Bitacora::activa()) {
+            std::cout << "[Asignacion] Operador de copia invocado" << std::endl;
+        }
         if (this != &origen) {
             vaciar();
             duplicarDesde(origen);
@@ -72,7 +208,9 @@ public:
      * Libera toda la memoria dinamica ocupada por los nodos de la lista.
      */
     ~ListaSensor() {
-        std::cout << "[Destruccion] Liberando estructura de lista..." << std::endl;
+        if (Bitacora::activa()) {
+            std::cout << "[Destruccion] Liberando estructura de lista..." << std::endl;
+        }
         vaciar();
     }
     
@@ -81,22 +219,125 @@ public:
      * @param contenido Dato a insertar
      * 
      * Crea un nuevo nodo con el contenido proporcionado y lo agrega
-     * al final de la lista enlazada.
+     * al final de la lista enlazada. El enlace se realiza en tiempo
+     * constante mediante la referencia al ultimo elemento.
      */
-    void insertarAlFinal(T contenido) {
-        Nodo<T>* nuevoElemento = new Nodo<T>(contenido);
-        
-        if (primero == nullptr) {
-            primero = nuevoElemento;
+    void insertarAlFinal(typename ParametroNodo<T>::tipo contenido) {
+        enlazarAlFinal(new Nodo<T>(contenido));
+        if (Bitacora::activa()) {
+            std::cout << "[Agregacion] Elemento de tipo<" << typeid(T).name() << "> agregado" << std::endl;
+        }
+    }
+    
+    /**
+     * @brief Reserva memoria para nodos que se insertaran a continuacion
+     * @param cantidad Numero de nodos a reservar
+     * 
+     * Solicita los nodos en un unico bloque contiguo, de modo que las
+     * inserciones siguientes no requieran asignaciones individuales.
+     */
+    void reservar(int cantidad) {
+        if (cantidad > 0) {
+            PoolNodos<T>::reservar(static_cast<std::size_t>(cantidad));
+        }
+    }
+    
+    /**
+     * @brief Inserta los elementos de un rango al final de la lista
+     * @tparam IteradorEntrada Iterador cuyo valor es convertible a T
+     * @param desde Primer elemento del rango
+     * @param hasta Posicion posterior al ultimo elemento
+     * @return Cantidad de elementos insertados
+     * 
+     * Si el rango admite varias pasadas (iterador de avance o superior),
+     * todos los nodos se reservan en un solo bloque. Los nodos se encadenan
+     * entre si y se unen a la lista una sola vez, emitiendo un unico
+     * mensaje de resumen en lugar de uno por elemento.
+     */
+    template <typename IteradorEntrada>
+    int insertarRango(IteradorEntrada desde, IteradorEntrada hasta) {
+        reservarRango(desde, hasta, typename std::iterator_traits<IteradorEntrada>::iterator_category());
+        const int cantidad = enlazarRango(desde, hasta);
+        if (cantidad > 0 && Bitacora::activa()) {
+            std::cout << "[Agregacion] " << cantidad << " elementos de tipo<" << typeid(T).name()
+                      << "> agregados en bloque" << std::endl;
+        }
+        return cantidad;
+    }
+    
+    /**
+     * @brief Inserta un arreglo de elementos al final de la lista
+     * @param datos Arreglo de origen
+     * @param cantidad Numero de elementos del arreglo
+     * 
+     * Equivale a insertarRango(datos, datos + cantidad).
+     */
+    void insertarBloque(const T* datos, int cantidad) {
+        if (cantidad > 0) {
+            insertarRango(datos, datos + cantidad);
+        }
+    }
+    
+    /**
+     * @brief Traslada al final de esta lista todos los nodos de otra
+     * @param otra Lista de origen, que queda vacia
+     * 
+     * Opera en tiempo constante: solo se reescriben los extremos, sin
+     * copiar ni reservar nodos.
+     */
+    void empalmar(ListaSensor& otra) {
+        if (&otra == this || otra.primero == nullptr) {
+            return;
+        }
+        const int trasladados = otra.elementos;
+        enlazarCadena(otra.primero, otra.ultimo, trasladados);
+        otra.primero = nullptr;
+        otra.ultimo = nullptr;
+        otra.elementos = 0;
+        otra.ultimoAcierto = nullptr;
+        if (Bitacora::activa()) {
+            std::cout << "[Empalme] " << trasladados << " elementos de tipo<" << typeid(T).name()
+                      << "> trasladados" << std::endl;
+        }
+    }
+    
+    /**
+     * @brief Separa los elementos desde una posicion hacia otra lista
+     * @param posicion Indice del primer elemento trasladado (0 a getTamanio())
+     * @param resto Lista a cuyo final se agregan los elementos separados
+     * @return true si la posicion era valida, false en caso contrario
+     * 
+     * Esta lista conserva los primeros posicion elementos. Localizar el
+     * corte requiere recorrer posicion nodos; el traslado es constante.
+     */
+    bool dividir(int posicion, ListaSensor& resto) {
+        if (posicion < 0 || posicion > elementos || &resto == this) {
+            return false;
+        }
+        if (posicion == elementos) {
+            return true;
+        }
+        const int trasladados = elementos - posicion;
+        if (posicion == 0) {
+            resto.enlazarCadena(primero, ultimo, trasladados);
+            primero = nullptr;
+            ultimo = nullptr;
         } else {
-            Nodo<T>* navegador = primero;
-            while (navegador->siguiente != nullptr) {
-                navegador = navegador->siguiente;
+            Nodo<T>* corte = primero;
+            for (int i = 1; i < posicion; i++) {
+                corte = corte->siguiente;
             }
-            navegador->siguiente = nuevoElemento;
+            resto.enlazarCadena(corte->siguiente, ultimo, trasladados);
+            corte->siguiente = nullptr;
+            ultimo = corte;
         }
-        elementos++;
-        std::cout << "[Agregacion] Elemento de tipo<" << typeid(T).name() << "> agregado" << std::endl;
+        elementos = posicion;
+        ultimoAcierto = nullptr;
+        if (Bitacora::activa()) {
+            std::cout << "[Division] " << trasladados << " elementos de tipo<" << typeid(T).name()
+                      << "> separados en la posicion " << posicion << std::endl;
+        }
+        return true;
     }
     
     /**
@@ -107,7 +348,7 @@ public:
      * Recorre la lista secuencialmente comparando cada elemento
      * con el dato buscado.
      */
-    Nodo<T>* buscar(T contenido) const {
+    Nodo<T>* buscar(typename ParametroNodo<T>::tipo contenido) const {
         Nodo<T>* navegador = primero;
         while (navegador != nullptr) {
             if (navegador->dato == contenido) {
@@ -118,6 +359,82 @@ public:
         return nullptr;
     }
     
+    /**
+     * @brief Busca el primer elemento que cumple una condicion
+     * @tparam Predicado Funcion bool(const T&)
+     * @param predicado Condicion buscada
+     * @return Nodo encontrado, nullptr si ningun elemento la cumple
+     * 
+     * El recorrido se detiene en la primera coincidencia. Salvo con
+     * BUSQUEDA_SECUENCIAL, antes de recorrer se prueba el ultimo nodo
+     * encontrado, que entonces puede no ser la primera coincidencia si
+     * varios elementos cumplen la condicion. Esta version no reordena la
+     * lista, cualquiera sea la politica.
+     */
+    template <typename Predicado>
+    Nodo<T>* buscarSi(Predicado predicado) const {
+        if (politica != BUSQUEDA_SECUENCIAL && ultimoAcierto != nullptr && predicado(ultimoAcierto->dato)) {
+            return ultimoAcierto;
+        }
+        Nodo<T>* navegador = primero;
+        while (navegador != nullptr) {
+            if (predicado(navegador->dato)) {
+                ultimoAcierto = navegador;
+                return navegador;
+            }
+            navegador = navegador->siguiente;
+        }
+        return nullptr;
+    }
+    
+    /**
+     * @brief Busca el primer elemento que cumple una condicion, aplicando la politica
+     * @tparam Predicado Funcion bool(const T&)
+     * @param predicado Condicion buscada
+     * @return Nodo encontrado, nullptr si ningun elemento la cumple
+     * 
+     * Con BUSQUEDA_MOVER_AL_FRENTE, el nodo encontrado se desenlaza y pasa
+     * al inicio, en tiempo constante; los nodos no se copian ni cambian de
+     * direccion. En otro caso equivale a la version constante.
+     */
+    template <typename Predicado>
+    Nodo<T>* buscarSi(Predicado predicado) {
+        if (politica != BUSQUEDA_MOVER_AL_FRENTE) {
+            return static_cast<const ListaSensor*>(this)->buscarSi(predicado);
+        }
+        if (primero != nullptr && predicado(primero->dato)) {
+            ultimoAcierto = primero;
+            return primero;
+        }
+        Nodo<T>* anterior = primero;
+        while (anterior != nullptr && anterior->siguiente != nullptr) {
+            Nodo<T>* candidato = anterior->siguiente;
+            if (predicado(candidato->dato)) {
+                anterior->siguiente = candidato->siguiente;
+                if (candidato == ultimo) {
+                    ultimo = anterior;
+                }
+                candidato->siguiente = primero;
+                primero = candidato;
+                ultimoAcierto = candidato;
+                return candidato;
+            }
+            anterior = candidato;
+        }
+        return nullptr;
+    }
+    
+    /**
+     * @brief Selecciona la estrategia de buscarSi
+     * @param nueva Politica a aplicar desde la proxima busqueda
+     */
+    void setPoliticaBusqueda(PoliticaBusqueda nueva) {
+        politica = nueva;
+        ultimoAcierto = nullptr;
+    }
+    
+    PoliticaBusqueda getPoliticaBusqueda() const { return politica; }
+    
     /**
      * @brief Obtiene la cantidad de elementos en la lista
      * @return Numero de elementos almacenados
@@ -126,6 +443,41 @@ public:
         return elementos;
     }
     
+    /**
+     * @brief Obtiene el maximo de elementos simultaneos
+     * @return Mayor tamanio alcanzado desde la creacion o el ultimo reinicio
+     */
+    int getPicoElementos() const {
+        return picoElementos;
+    }
+    
+    /**
+     * @brief Memoria ocupada por la lista y sus nodos
+     * @return Bytes del objeto mas los de cada nodo vivo
+     * 
+     * Los nodos provienen de PoolNodos, sin cabecera del asignador general
+     * por nodo; la reserva sobrante del pool se informa con
+     * PoolNodos<T>::getBytesReservados().
+     */
+    std::size_t bytesOcupados() const {
+        return sizeof(ListaSensor) + static_cast<std::size_t>(elementos) * sizeof(Nodo<T>);
+    }
+    
+    /**
+     * @brief Memoria de la lista en su maximo de elementos
+     * @return Bytes que ocupaba la lista con getPicoElementos() nodos
+     */
+    std::size_t bytesPico() const {
+        return sizeof(ListaSensor) + static_cast<std::size_t>(picoElementos) * sizeof(Nodo<T>);
+    }
+    
+    /**
+     * @brief Reinicia el maximo al tamanio actual
+     */
+    void reiniciarPico() {
+        picoElementos = elementos;
+    }
+    
     /**
      * @brief Verifica si la lista esta vacia
      * @return true si la lista no contiene elementos, false en caso contrario
@@ -142,6 +494,21 @@ public:
         return primero;
     }
     
+    /**
+     * @brief Iterador al primer elemento
+     */
+    iterator begin() { return iterator(primero); }
+    
+    /**
+     * @brief Iterador posterior al ultimo elemento
+     */
+    iterator end() { return iterator(); }
+    
+    const_iterator begin() const { return const_iterator(primero); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cbegin() const { return const_iterator(primero); }
+    const_iterator cend() const { return const_iterator(); }
+    
     /**
      * @brief Itera sobre todos los elementos aplicando una operacion
      * @tparam Operacion Tipo de la funcion a aplicar
@@ -159,41 +526,372 @@ public:
         }
     }
     
+    /**
+     * @brief Elimina el primer elemento
+     * @return true si habia un elemento, false si la lista estaba vacia
+     * 
+     * Opera en tiempo constante.
+     */
+    bool eliminarPrimero() {
+        if (primero == nullptr) {
+            return false;
+        }
+        Nodo<T>* retirado = primero;
+        primero = retirado->siguiente;
+        if (primero == nullptr) {
+            ultimo = nullptr;
+        }
+        liberarNodo(retirado);
+        return true;
+    }
+    
+    /**
+     * @brief Elimina el elemento que sigue a un nodo de la lista
+     * @param nodo Nodo previo al eliminado; nullptr elimina el primero
+     * @return true si habia un elemento a continuacion, false en caso contrario
+     * 
+     * Opera en tiempo constante: el nodo previo se obtiene de buscarSi, de
+     * getCabeza o de un recorrido ya en curso.
+     */
+    bool eliminarDespuesDe(Nodo<T>* nodo) {
+        if (nodo == nullptr) {
+            return eliminarPrimero();
+        }
+        Nodo<T>* retirado = nodo->siguiente;
+        if (retirado == nullptr) {
+            return false;
+        }
+        nodo->siguiente = retirado->siguiente;
+        if (retirado == ultimo) {
+            ultimo = nodo;
+        }
+        liberarNodo(retirado);
+        return true;
+    }
+    
+    /**
+     * @brief Elimina la primera aparicion de un valor
+     * @param contenido Dato a eliminar
+     * @return true si el valor estaba en la lista
+     * 
+     * El recorrido se detiene en la primera coincidencia; si el valor es
+     * el primero (por ejemplo, tras una busqueda con BUSQUEDA_MOVER_AL_FRENTE)
+     * la eliminacion es inmediata.
+     */
+    bool eliminar(const T& contenido) {
+        Nodo<T>* anterior = nullptr;
+        Nodo<T>* navegador = primero;
+        while (navegador != nullptr) {
+            if (navegador->dato == contenido) {
+                return eliminarDespuesDe(anterior);
+            }
+            anterior = navegador;
+            navegador = navegador->siguiente;
+        }
+        return false;
+    }
+    
+    /**
+     * @brief Elimina todos los elementos que cumplen una condicion
+     * @tparam Predicado Funcion bool(const T&)
+     * @param predicado Condicion de eliminacion
+     * @return Cantidad de elementos eliminados
+     * 
+     * Una sola pasada; los elementos restantes conservan su orden.
+     */
+    template <typename Predicado>
+    int eliminarSi(Predicado predicado) {
+        int eliminados = 0;
+        Nodo<T>* anterior = nullptr;
+        Nodo<T>* navegador = primero;
+        while (navegador != nullptr) {
+            Nodo<T>* siguiente = navegador->siguiente;
+            if (predicado(navegador->dato)) {
+                eliminarDespuesDe(anterior);
+                eliminados++;
+            } else {
+                anterior = navegador;
+            }
+            navegador = siguiente;
+        }
+        return eliminados;
+    }
+    
     /**
      * @brief Elimina todos los elementos de la lista
      * 
      * Libera la memoria de todos los nodos y reinicia el contador.
-     * Despues de esta operacion, la lista queda vacia.
+     * Despues de esta operacion, la lista queda vacia. Si T no requiere
+     * destructor (ElementoTrivial) y la bitacora esta inactiva, la cadena
+     * completa vuelve al pool en tiempo constante, sin recorrerla.
      */
     void vaciar() {
+        if (primero != nullptr && !Bitacora::activa()) {
+            devolverNodos(std::integral_constant<bool, ElementoTrivial<T>::value>());
+        }
         while (primero != nullptr) {
             Nodo<T>* temporal = primero;
             primero = primero->siguiente;
-            std::cout << "[Liberacion] Elemento<" << typeid(T).name() << "> eliminado" << std::endl;
+            if (Bitacora::activa()) {
+                std::cout << "[Liberacion] Elemento<" << typeid(T).name() << "> eliminado" << std::endl;
+            }
             delete temporal;
             elementos--;
         }
+        ultimo = nullptr;
+        ultimoAcierto = nullptr;
+    }
+    
+    /**
+     * @brief Elimina todos los elementos aplicando antes una operacion a cada uno
+     * @tparam Operacion Invocable con firma void(T&)
+     * @param operacion Se aplica a cada elemento, en orden, antes de liberar su nodo
+     * 
+     * Permite liberar lo que apuntan los elementos en el mismo recorrido
+     * que libera los nodos. Sin bitacora, los nodos de un T trivial
+     * vuelven al pool en bloque como en vaciar().
+     */
+    template <typename Operacion>
+    void vaciar(Operacion operacion) {
+        if (!Bitacora::activa() && ElementoTrivial<T>::value) {
+            for (Nodo<T>* nodo = primero; nodo != nullptr; nodo = nodo->siguiente) {
+                operacion(nodo->dato);
+            }
+            vaciar();
+            return;
+        }
+        while (primero != nullptr) {
+            Nodo<T>* temporal = primero;
+            primero = primero->siguiente;
+            operacion(temporal->dato);
+            if (Bitacora::activa()) {
+                std::cout << "[Liberacion] Elemento<" << typeid(T).name() << "> eliminado" << std::endl;
+            }
+            delete temporal;
+            elementos--;
+        }
+        ultimo = nullptr;
+        ultimoAcierto = nullptr;
+    }
+    
+    /**
+     * @brief Escribe el contenido de la lista en formato binario
+     * @param salida Flujo binario de destino
+     * @return true si la escritura fue exitosa, false en caso contrario
+     * 
+     * Escribe la cantidad de elementos (64 bits) seguida de los datos en
+     * su representacion de memoria. Solo es valido para tipos de dato
+     * simples (int, float, double), sin punteros internos.
+     */
+    bool guardarBinario(std::ostream& salida) const {
+        const uint64_t cantidad = static_cast<uint64_t>(elementos);
+        salida.write(reinterpret_cast<const char*>(&cantidad), sizeof(cantidad));
+        
+        std::vector<T> tramo;
+        tramo.reserve(TAMANIO_TRAMO);
+        Nodo<T>* navegador = primero;
+        while (navegador != nullptr) {
+            tramo.push_back(navegador->dato);
+            if (tramo.size() == TAMANIO_TRAMO) {
+                salida.write(reinterpret_cast<const char*>(tramo.data()), tramo.size() * sizeof(T));
+                tramo.clear();
+            }
+            navegador = navegador->siguiente;
+        }
+        if (!tramo.empty()) {
+            salida.write(reinterpret_cast<const char*>(tramo.data()), tramo.size() * sizeof(T));
+        }
+        return static_cast<bool>(salida);
+    }
+    
+    /**
+     * @brief Agrega al final el contenido escrito por guardarBinario
+     * @param entrada Flujo binario de origen
+     * @return true si la lectura fue exitosa, false si el flujo esta truncado
+     * 
+     * Procesa los datos por tramos para no duplicar la memoria del
+     * historial; los nodos de cada tramo se reservan en un bloque una vez
+     * leido, de modo que una cantidad corrupta en un flujo truncado no
+     * reserva memoria que el pool conservaria.
+     */
+    bool cargarBinario(std::istream& entrada) {
+        uint64_t cantidad = 0;
+        if (!entrada.read(reinterpret_cast<char*>(&cantidad), sizeof(cantidad))) {
+            return false;
+        }
+        if (cantidad > static_cast<uint64_t>(INT32_MAX - elementos)) {
+            return false;
+        }
+        std::vector<T> tramo(cantidad < TAMANIO_TRAMO ? static_cast<std::size_t>(cantidad) : TAMANIO_TRAMO);
+        uint64_t pendientes = cantidad;
+        while (pendientes > 0) {
+            const std::size_t porLeer = pendientes < TAMANIO_TRAMO
+                ? static_cast<std::size_t>(pendientes) : TAMANIO_TRAMO;
+            if (!entrada.read(reinterpret_cast<char*>(tramo.data()), porLeer * sizeof(T))) {
+                return false;
+            }
+            reservar(static_cast<int>(porLeer));
+            enlazarRango(tramo.begin(), tramo.begin() + porLeer);
+            pendientes -= porLeer;
+        }
+        return true;
     }
     
 private:
+    static const std::size_t TAMANIO_TRAMO = 65536;  ///< Elementos por tramo de E/S binaria
+    
+    /**
+     * @brief Enlaza un nodo ya creado al final de la lista
+     * @param nuevoElemento Nodo a enlazar
+     */
+    void enlazarAlFinal(Nodo<T>* nuevoElemento) {
+        if (primero == nullptr) {
+            primero = nuevoElemento;
+        } else {
+            ultimo->siguiente = nuevoElemento;
+        }
+        ultimo = nuevoElemento;
+        elementos++;
+        if (elementos > picoElementos) {
+            picoElementos = elementos;
+        }
+    }
+    
+    /**
+     * @brief Libera un nodo ya desenlazado y actualiza el contador
+     * @param retirado Nodo que ya no pertenece a la cadena
+     */
+    void liberarNodo(Nodo<T>* retirado) {
+        if (retirado == ultimoAcierto) {
+            ultimoAcierto = nullptr;
+        }
+        if (Bitacora::activa()) {
+            std::cout << "[Liberacion] Elemento<" << typeid(T).name() << "> eliminado" << std::endl;
+        }
+        delete retirado;
+        elementos--;
+    }
+    
+    /**
+     * @brief Une al final una cadena de nodos ya enlazados entre si
+     * @param cabeza Primer nodo de la cadena
+     * @param cola Ultimo nodo de la cadena (su siguiente debe ser nullptr)
+     * @param cantidad Nodos de la cadena
+     */
+    void enlazarCadena(Nodo<T>* cabeza, Nodo<T>* cola, int cantidad) {
+        if (primero == nullptr) {
+            primero = cabeza;
+        } else {
+            ultimo->siguiente = cabeza;
+        }
+        ultimo = cola;
+        elementos += cantidad;
+        if (elementos > picoElementos) {
+            picoElementos = elementos;
+        }
+    }
+    
+    /**
+     * @brief Crea un nodo por elemento del rango y los une al final
+     * @return Cantidad de nodos creados
+     */
+    template <typename IteradorEntrada>
+    int enlazarRango(IteradorEntrada desde, IteradorEntrada hasta) {
+        Nodo<T>* cabeza = nullptr;
+        Nodo<T>* cola = nullptr;
+        int cantidad = 0;
+        for (; desde != hasta; ++desde) {
+            Nodo<T>* nuevo = new Nodo<T>(*desde);
+            if (cabeza == nullptr) {
+                cabeza = nuevo;
+            } else {
+                cola->siguiente = nuevo;
+            }
+            cola = nuevo;
+            cantidad++;
+        }
+        if (cantidad > 0) {
+            enlazarCadena(cabeza, cola, cantidad);
+        }
+        return cantidad;
+    }
+    
+    /**
+     * @brief Reserva los nodos de un rango que admite varias pasadas
+     */
+    template <typename IteradorAvance>
+    void reservarRango(IteradorAvance desde, IteradorAvance hasta, std::forward_iterator_tag) {
+        const typename std::iterator_traits<IteradorAvance>::difference_type cantidad = std::distance(desde, hasta);
+        if (cantidad > 0) {
+            PoolNodos<T>::reservar(static_cast<std::size_t>(cantidad));
+        }
+    }
+    
+    /**
+     * @brief Un rango de una sola pasada no se puede medir de antemano
+     */
+    template <typename IteradorEntrada>
+    void reservarRango(IteradorEntrada, IteradorEntrada, std::input_iterator_tag) {}
+    
+    /**
+     * @brief Devuelve toda la cadena al pool sin destruir los nodos
+     */
+    void devolverNodos(std::true_type) {
+        PoolNodos<T>::devolverCadena(primero, ultimo, static_cast<std::size_t>(elementos));
+        primero = nullptr;
+        ultimo = nullptr;
+        elementos = 0;
+        ultimoAcierto = nullptr;
+    }
+    
+    /**
+     * @brief Los nodos con destructor se liberan de a uno en vaciar()
+     */
+    void devolverNodos(std::false_type) {}
+    
     /**
      * @brief Metodo auxiliar para duplicar contenido de otra lista
      * @param origen Lista fuente de la copia
      * 
-     * Copia todos los elementos de la lista origen a esta lista.
+     * Copia todos los elementos de la lista origen a esta lista, con los
+     * nodos reservados en un solo bloque.
      * Utilizado por el constructor de copia y operador de asignacion.
      */
     void duplicarDesde(const ListaSensor& origen) {
         if (origen.primero == nullptr) {
             return;
         }
-        
-        Nodo<T>* navegadorOrigen = origen.primero;
-        while (navegadorOrigen != nullptr) {
-            insertarAlFinal(navegadorOrigen->dato);
-            navegadorOrigen = navegadorOrigen->siguiente;
+        copiarElementos(origen, std::integral_constant<bool, ElementoTrivial<T>::value>());
+    }
+    
+    /**
+     * @brief Copia byte a byte sobre una cadena de nodos obtenida del pool
+     * 
+     * Los nodos se toman del pool y se escriben en una sola pasada junto
+     * con el recorrido del origen (contiguos si provienen de un bloque
+     * nuevo), sin construirlos ni enlazarlos por separado.
+     */
+    void copiarElementos(const ListaSensor& origen, std::true_type) {
+        const Nodo<T>* fuente = origen.primero;
+        Nodo<T>* cola = nullptr;
+        Nodo<T>* cabeza = PoolNodos<T>::obtenerCadena(static_cast<std::size_t>(origen.elementos), cola,
+                                                      [&fuente](Nodo<T>* destino) {
+            std::memcpy(static_cast<void*>(&destino->dato), &fuente->dato, sizeof(T));
+            fuente = fuente->siguiente;
+        });
+        enlazarCadena(cabeza, cola, origen.elementos);
+        if (Bitacora::activa()) {
+            std::cout << "[Agregacion] " << origen.elementos << " elementos de tipo<" << typeid(T).name()
+                      << "> agregados en bloque" << std::endl;
         }
     }
+    
+    /**
+     * @brief Copia general: un nodo construido por elemento
+     */
+    void copiarElementos(const ListaSensor& origen, std::false_type) {
+        insertarRango(origen.cbegin(), origen.cend());
+    }
 };
 
 #endif // LISTASENSOR_H
@@ -0,0 +1,305 @@
+/**
+ * @file ListaSinCerrojos.h
+ * @brief Lista enlazada ordenada por clave para multiples escritores sin cerrojos
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef LISTASINCERROJOS_H
+#define LISTASINCERROJOS_H
+
+#include "ReclamacionEpocas.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct NodoSinCerrojos
+ * @brief Nodo con clave cuyo enlace lleva la marca de borrado en el bit bajo
+ */
+template <typename T>
+struct NodoSinCerrojos {
+    unsigned long long clave;                   ///< Clave de orden (unica en la lista)
+    T dato;                                     ///< Valor asociado
+    std::atomic<NodoSinCerrojos<T>*> siguiente;  ///< Enlace; bit bajo = nodo borrado logicamente
+    
+    NodoSinCerrojos(unsigned long long k, const T& valor) : clave(k), dato(valor), siguiente(nullptr) {}
+};
+
+/**
+ * @class ListaSinCerrojos
+ * @brief Variante de ListaSensor en la que varios hilos insertan, buscan y retiran a la vez
+ * 
+ * Sigue el algoritmo de Harris con las correcciones de Michael: la lista
+ * se mantiene ordenada por clave, lo que permite que insertar detecte
+ * claves repetidas sin cerrojos (dos hilos que registran el mismo sensor
+ * compiten por el mismo enlace y solo uno gana el CAS).
+ * 
+ * - Insertar enlaza el nodo nuevo con un CAS sobre el enlace del anterior.
+ * - Retirar primero marca el enlace del nodo (borrado logico) y despues lo
+ *   desenlaza; cualquier recorrido que encuentre un nodo marcado ayuda a
+ *   desenlazarlo.
+ * - Buscar e iterar solo leen: no escriben ni esperan.
+ * - Los nodos desenlazados se liberan por epocas (DominioEpocas): cada
+ *   operacion anuncia su epoca y el hilo que desenlaza un nodo lo guarda
+ *   en la lista de retirados de su ranura hasta que sea seguro liberarlo.
+ * 
+ * @tparam T Tipo de los elementos (copiable)
+ */
+template <typename T>
+class ListaSinCerrojos {
+private:
+    typedef NodoSinCerrojos<T> NodoLista;
+    static const std::size_t UMBRAL_RECOLECCION = 64;  ///< Retirados por ranura que disparan la primera recoleccion
+    
+    /**
+     * @struct NodoRetirado
+     * @brief Nodo desenlazado pendiente de liberar
+     */
+    struct NodoRetirado {
+        NodoLista* nodo;           ///< Nodo fuera de la lista
+        unsigned long long epoca;  ///< Epoca global al retirarlo
+    };
+    
+    std::atomic<NodoLista*> cabeza;  ///< Primer nodo (nunca marcado)
+    std::atomic<int> elementos;      ///< Elementos no borrados
+    mutable DominioEpocas epocas;    ///< Epocas anunciadas por las operaciones en curso
+    std::vector<NodoRetirado> retirados[DominioEpocas::MAX_PARTICIPANTES];  ///< Pendientes, por ranura
+    std::size_t umbrales[DominioEpocas::MAX_PARTICIPANTES];                 ///< Pendientes que disparan la proxima recoleccion, por ranura
+    
+    ListaSinCerrojos(const ListaSinCerrojos&);
+    ListaSinCerrojos& operator=(const ListaSinCerrojos&);
+    
+    static bool marcado(NodoLista* enlace) {
+        return (reinterpret_cast<std::uintptr_t>(enlace) & 1u) != 0;
+    }
+    
+    static NodoLista* conMarca(NodoLista* nodo) {
+        return reinterpret_cast<NodoLista*>(reinterpret_cast<std::uintptr_t>(nodo) | 1u);
+    }
+    
+    static NodoLista* sinMarca(NodoLista* enlace) {
+        return reinterpret_cast<NodoLista*>(reinterpret_cast<std::uintptr_t>(enlace) & ~static_cast<std::uintptr_t>(1u));
+    }
+    
+    /**
+     * @brief Guarda un nodo desenlazado en la ranura de la operacion en curso
+     */
+    void retirar(int ranura, NodoLista* nodo) {
+        NodoRetirado pendiente;
+        pendiente.nodo = nodo;
+        pendiente.epoca = epocas.retirar();
+        retirados[ranura].push_back(pendiente);
+        if (retirados[ranura].size() >= umbrales[ranura]) {
+            recolectar(ranura);
+        }
+    }
+    
+    /**
+     * @brief Libera los pendientes de una ranura que ya nadie puede alcanzar
+     * 
+     * El umbral de la ranura pasa a ser el doble de los que sobreviven (y
+     * al menos UMBRAL_RECOLECCION): si una operacion retiene su epoca, los
+     * pendientes se acumulan sin que cada retiro vuelva a recorrerlos ni a
+     * revisar todas las ranuras, y el costo queda amortizado en O(1).
+     */
+    void recolectar(int ranura) {
+        std::vector<NodoRetirado>& pendientes = retirados[ranura];
+        const unsigned long long segura = epocas.epocaSegura();
+        std::size_t conservados = 0;
+        for (std::size_t i = 0; i < pendientes.size(); i++) {
+            if (pendientes[i].epoca < segura) {
+                delete pendientes[i].nodo;
+            } else {
+                pendientes[conservados++] = pendientes[i];
+            }
+        }
+        pendientes.resize(conservados);
+        const std::size_t minimo = UMBRAL_RECOLECCION;
+        umbrales[ranura] = std::max(minimo, 2 * conservados);
+    }
+    
+    /**
+     * @brief Ubica la posicion de una clave desenlazando los nodos marcados del camino
+     * @param ranura Ranura de la guarda activa
+     * @param clave Clave buscada
+     * @param previo Enlace que apunta a actual
+     * @param actual Primer nodo con clave >= clave (nullptr si no hay)
+     * @param siguiente Sucesor de actual
+     * @return true si actual tiene exactamente la clave buscada
+     */
+    bool localizar(int ranura, unsigned long long clave, std::atomic<NodoLista*>*& previo,
+                   NodoLista*& actual, NodoLista*& siguiente) {
+        for (;;) {
+            previo = &cabeza;
+            actual = previo->load(std::memory_order_acquire);
+            bool reintentar = false;
+            while (actual != nullptr) {
+                NodoLista* enlace = actual->siguiente.load(std::memory_order_acquire);
+                siguiente = sinMarca(enlace);
+                if (marcado(enlace)) {
+                    NodoLista* esperado = actual;
+                    if (!previo->compare_exchange_strong(esperado, siguiente, std::memory_order_acq_rel)) {
+                        // El anterior cambio o fue marcado: se recorre de nuevo
+                        reintentar = true;
+                        break;
+                    }
+                    retirar(ranura, actual);
+                    actual = siguiente;
+                    continue;
+                }
+                if (actual->clave >= clave) {
+                    return actual->clave == clave;
+                }
+                previo = &actual->siguiente;
+                actual = siguiente;
+            }
+            if (!reintentar) {
+                siguiente = nullptr;
+                return false;
+            }
+        }
+    }
+    
+public:
+    ListaSinCerrojos() : cabeza(nullptr), elementos(0) {
+        for (int r = 0; r < DominioEpocas::MAX_PARTICIPANTES; r++) {
+            umbrales[r] = UMBRAL_RECOLECCION;
+        }
+    }
+    
+    /**
+     * @brief Destructor; no debe haber operaciones en curso
+     */
+    ~ListaSinCerrojos() {
+        NodoLista* nodo = cabeza.load(std::memory_order_relaxed);
+        while (nodo != nullptr) {
+            NodoLista* siguiente = sinMarca(nodo->siguiente.load(std::memory_order_relaxed));
+            delete nodo;
+            nodo = siguiente;
+        }
+        for (int r = 0; r < DominioEpocas::MAX_PARTICIPANTES; r++) {
+            for (std::size_t i = 0; i < retirados[r].size(); i++) {
+                delete retirados[r][i].nodo;
+            }
+        }
+    }
+    
+    /**
+     * @brief Inserta un elemento si su clave no esta en la lista
+     * @param clave Clave del elemento
+     * @param valor Valor a insertar
+     * @param existente Si no es nulo y la clave ya estaba, recibe el valor presente
+     * @return true si se inserto; false si otro hilo ya habia registrado la clave
+     */
+    bool insertar(unsigned long long clave, const T& valor, T* existente = nullptr) {
+        DominioEpocas::Guarda guarda(epocas);
+        NodoLista* nuevo = nullptr;
+        for (;;) {
+            std::atomic<NodoLista*>* previo;
+            NodoLista* actual;
+            NodoLista* siguiente;
+            if (localizar(guarda.getRanura(), clave, previo, actual, siguiente)) {
+                if (existente != nullptr) {
+                    *existente = actual->dato;
+                }
+                delete nuevo;
+                return false;
+            }
+            if (nuevo == nullptr) {
+                nuevo = new NodoLista(clave, valor);
+            }
+            nuevo->siguiente.store(actual, std::memory_order_relaxed);
+            NodoLista* esperado = actual;
+            if (previo->compare_exchange_strong(esperado, nuevo, std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+                elementos.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    
+    /**
+     * @brief Retira el elemento con una clave
+     * @return true si este hilo lo retiro; false si no estaba o lo retiro otro
+     */
+    bool eliminar(unsigned long long clave) {
+        DominioEpocas::Guarda guarda(epocas);
+        for (;;) {
+            std::atomic<NodoLista*>* previo;
+            NodoLista* actual;
+            NodoLista* siguiente;
+            if (!localizar(guarda.getRanura(), clave, previo, actual, siguiente)) {
+                return false;
+            }
+            // Borrado logico: marcar el enlace propio impide inserciones detras
+            NodoLista* esperado = siguiente;
+            if (!actual->siguiente.compare_exchange_strong(esperado, conMarca(siguiente),
+                                                           std::memory_order_acq_rel)) {
+                continue;
+            }
+            elementos.fetch_sub(1, std::memory_order_relaxed);
+            NodoLista* desenlazado = actual;
+            if (previo->compare_exchange_strong(desenlazado, siguiente, std::memory_order_acq_rel)) {
+                retirar(guarda.getRanura(), actual);
+            } else {
+                localizar(guarda.getRanura(), clave, previo, actual, siguiente);
+            }
+            return true;
+        }
+    }
+    
+    /**
+     * @brief Busca el elemento con una clave sin escribir en la lista
+     * @param clave Clave buscada
+     * @param valor Recibe el valor si se encontro
+     * @return true si la clave esta presente y no fue retirada
+     */
+    bool buscar(unsigned long long clave, T& valor) const {
+        DominioEpocas::Guarda guarda(epocas);
+        NodoLista* nodo = cabeza.load(std::memory_order_acquire);
+        while (nodo != nullptr && nodo->clave < clave) {
+            nodo = sinMarca(nodo->siguiente.load(std::memory_order_acquire));
+        }
+        if (nodo == nullptr || nodo->clave != clave ||
+            marcado(nodo->siguiente.load(std::memory_order_acquire))) {
+            return false;
+        }
+        valor = nodo->dato;
+        return true;
+    }
+    
+    /**
+     * @brief Recorre los elementos no retirados en orden de clave
+     * @tparam Operacion Invocable con firma void(unsigned long long, const T&)
+     * @return Elementos visitados
+     * 
+     * Las inserciones y retiros concurrentes pueden o no reflejarse,
+     * pero cada clave se visita a lo sumo una vez.
+     */
+    template <typename Operacion>
+    int iterar(Operacion operacion) const {
+        DominioEpocas::Guarda guarda(epocas);
+        int visitados = 0;
+        NodoLista* nodo = cabeza.load(std::memory_order_acquire);
+        while (nodo != nullptr) {
+            NodoLista* enlace = nodo->siguiente.load(std::memory_order_acquire);
+            if (!marcado(enlace)) {
+                operacion(nodo->clave, nodo->dato);
+                visitados++;
+            }
+            nodo = sinMarca(enlace);
+        }
+        return visitados;
+    }
+    
+    /**
+     * @brief Elementos no retirados; aproximado mientras haya operaciones en curso
+     */
+    int getTamanio() const { return elementos.load(std::memory_order_relaxed); }
+};
+
+#endif // LISTASINCERROJOS_H
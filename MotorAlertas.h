@@ -0,0 +1,284 @@
+/**
+ * @file MotorAlertas.h
+ * @brief Evaluacion de reglas de alerta sobre cada medicion entrante
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef MOTORALERTAS_H
+#define MOTORALERTAS_H
+
+#include "ColaSPSC.h"
+#include "RelojMonotonico.h"
+#include "SensorBase.h"
+#include "TablaIdentificadores.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+/**
+ * @enum TipoAlerta
+ * @brief Regla que origino una alerta
+ */
+enum TipoAlerta {
+    ALERTA_UMBRAL_SUPERIOR = 0,  ///< La medicion supero el maximo
+    ALERTA_UMBRAL_INFERIOR = 1,  ///< La medicion quedo por debajo del minimo
+    ALERTA_TASA_CAMBIO = 2,      ///< La variacion por segundo supero el limite
+    ALERTA_PUNTAJE_Z = 3,        ///< La medicion se aparto de la media historica
+    ALERTA_SENSOR_ESTANCADO = 4  ///< El sensor repitio el mismo valor demasiadas veces
+};
+
+/**
+ * @struct Alerta
+ * @brief Evento producido por el motor de alertas
+ */
+struct Alerta {
+    TipoAlerta tipo;     ///< Regla disparada
+    IdSensor sensor;     ///< Nombre internado del sensor
+    double valor;        ///< Medicion que disparo la regla
+    double referencia;   ///< Limite, tasa, puntaje o repeticiones observados
+    MarcaTiempo marca;   ///< Instante de la medicion
+};
+
+/**
+ * @struct ReglasAlerta
+ * @brief Conjunto de reglas compilado a parametros numericos
+ * 
+ * Cada regla desactivada conserva un limite inalcanzable (infinito o cero
+ * repeticiones), de modo que la evaluacion recorre siempre las mismas
+ * comparaciones sin consultar que reglas estan activas.
+ */
+struct ReglasAlerta {
+    double maximo;            ///< Umbral superior
+    double minimo;            ///< Umbral inferior
+    double tasaMaxima;        ///< Variacion absoluta maxima por segundo
+    double puntajeZMaximo;    ///< Desviaciones estandar admitidas respecto de la media
+    long long muestrasMinimasZ;  ///< Mediciones previas necesarias para evaluar el puntaje z
+    int repeticionesMaximas;  ///< Valores identicos consecutivos que indican estancamiento (0 = sin regla)
+    
+    ReglasAlerta()
+        : maximo(std::numeric_limits<double>::infinity()),
+          minimo(-std::numeric_limits<double>::infinity()),
+          tasaMaxima(std::numeric_limits<double>::infinity()),
+          puntajeZMaximo(std::numeric_limits<double>::infinity()),
+          muestrasMinimasZ(30), repeticionesMaximas(0) {}
+};
+
+/**
+ * @class MotorAlertas
+ * @brief Evalua un conjunto de reglas en linea con la ingesta
+ * 
+ * Por sensor se conserva la ultima medicion, las repeticiones consecutivas
+ * y la media y varianza acumuladas con el algoritmo de Welford. Cada
+ * medicion cuesta una busqueda en tabla hash y un punado de comparaciones.
+ * 
+ * Las alertas se disparan por flanco: una regla que sigue violada en
+ * mediciones sucesivas genera una sola alerta hasta que deja de cumplirse.
+ * Las alertas se depositan en una ColaSPSC que consume otro hilo, de modo
+ * que la ingesta nunca espera a la consola.
+ */
+class MotorAlertas {
+private:
+    /// Estado de las reglas para un sensor
+    struct EstadoSensor {
+        long long muestras;     ///< Mediciones evaluadas
+        double media;           ///< Media acumulada
+        double m2;              ///< Suma de cuadrados de desviaciones (Welford)
+        double ultimoValor;     ///< Medicion anterior
+        MarcaTiempo ultimaMarca; ///< Instante de la medicion anterior
+        int repeticiones;       ///< Valores identicos consecutivos
+        unsigned activas;       ///< Reglas violadas en la medicion anterior (un bit por TipoAlerta)
+        EstadoSensor()
+            : muestras(0), media(0.0), m2(0.0), ultimoValor(0.0), ultimaMarca(0),
+              repeticiones(0), activas(0) {}
+    };
+    
+    ReglasAlerta reglas;  ///< Reglas vigentes
+    ColaSPSC<Alerta>& cola;  ///< Destino de las alertas
+    std::unordered_map<const SensorBase*, EstadoSensor> estados;  ///< Estado por sensor
+    unsigned long long emitidas;  ///< Alertas encoladas
+    
+    bool emitir(TipoAlerta tipo, const SensorBase* sensor, double valor, double referencia, MarcaTiempo marca) {
+        Alerta alerta;
+        alerta.tipo = tipo;
+        alerta.sensor = sensor->getId();
+        alerta.valor = valor;
+        alerta.referencia = referencia;
+        alerta.marca = marca;
+        if (!cola.intentarEncolar(alerta)) {
+            return false;
+        }
+        emitidas++;
+        return true;
+    }
+    
+public:
+    /**
+     * @brief Constructor
+     * @param conjunto Reglas a evaluar
+     * @param destino Cola donde se depositan las alertas
+     */
+    MotorAlertas(const ReglasAlerta& conjunto, ColaSPSC<Alerta>& destino)
+        : reglas(conjunto), cola(destino), emitidas(0) {}
+    
+    /**
+     * @brief Evalua las reglas para una medicion recien llegada
+     * @param sensor Sensor que produjo la medicion
+     * @param valor Medicion
+     * @param marca Instante de la medicion
+     * @return Cantidad de alertas nuevas encoladas
+     */
+    int evaluar(const SensorBase* sensor, double valor, MarcaTiempo marca) {
+        EstadoSensor& estado = estados[sensor];
+        
+        // Tasa de cambio comparada sin dividir: cambio * 1000 > tasaMaxima * milisegundos
+        double cambio = 0.0;
+        double milisegundos = 1.0;
+        const double desvio = valor - estado.media;
+        if (estado.muestras > 0) {
+            const MarcaTiempo transcurrido = marca - estado.ultimaMarca;
+            cambio = valor > estado.ultimoValor ? valor - estado.ultimoValor : estado.ultimoValor - valor;
+            milisegundos = static_cast<double>(transcurrido > 0 ? transcurrido : 1);
+            estado.repeticiones = valor == estado.ultimoValor ? estado.repeticiones + 1 : 0;
+        }
+        
+        // Puntaje z comparado en cuadrados para evitar la raiz
+        const double varianza = estado.muestras > 1 ? estado.m2 / static_cast<double>(estado.muestras - 1) : 0.0;
+        const bool atipico = estado.muestras >= reglas.muestrasMinimasZ &&
+                             desvio * desvio > reglas.puntajeZMaximo * reglas.puntajeZMaximo * varianza;
+        
+        unsigned violadas = 0;
+        violadas |= static_cast<unsigned>(valor > reglas.maximo) << ALERTA_UMBRAL_SUPERIOR;
+        violadas |= static_cast<unsigned>(valor < reglas.minimo) << ALERTA_UMBRAL_INFERIOR;
+        violadas |= static_cast<unsigned>(cambio * 1000.0 > reglas.tasaMaxima * milisegundos) << ALERTA_TASA_CAMBIO;
+        violadas |= static_cast<unsigned>(atipico) << ALERTA_PUNTAJE_Z;
+        violadas |= static_cast<unsigned>(reglas.repeticionesMaximas > 0 &&
+                                          estado.repeticiones + 1 >= reglas.repeticionesMaximas)
+                    << ALERTA_SENSOR_ESTANCADO;
+        
+        const unsigned nuevas = violadas & ~estado.activas;
+        estado.activas = violadas;
+        
+        // Actualizacion de Welford
+        estado.muestras++;
+        estado.media += desvio / static_cast<double>(estado.muestras);
+        estado.m2 += desvio * (valor - estado.media);
+        estado.ultimoValor = valor;
+        estado.ultimaMarca = marca;
+        
+        if (nuevas == 0) {
+            return 0;
+        }
+        int encoladas = 0;
+        if (nuevas & (1u << ALERTA_UMBRAL_SUPERIOR)) {
+            encoladas += emitir(ALERTA_UMBRAL_SUPERIOR, sensor, valor, reglas.maximo, marca);
+        }
+        if (nuevas & (1u << ALERTA_UMBRAL_INFERIOR)) {
+            encoladas += emitir(ALERTA_UMBRAL_INFERIOR, sensor, valor, reglas.minimo, marca);
+        }
+        if (nuevas & (1u << ALERTA_TASA_CAMBIO)) {
+            encoladas += emitir(ALERTA_TASA_CAMBIO, sensor, valor, cambio * 1000.0 / milisegundos, marca);
+        }
+        if (nuevas & (1u << ALERTA_PUNTAJE_Z)) {
+            const double puntaje = varianza > 0.0 ? desvio / std::sqrt(varianza) : 0.0;
+            encoladas += emitir(ALERTA_PUNTAJE_Z, sensor, valor, puntaje, marca);
+        }
+        if (nuevas & (1u << ALERTA_SENSOR_ESTANCADO)) {
+            encoladas += emitir(ALERTA_SENSOR_ESTANCADO, sensor, valor, estado.repeticiones + 1, marca);
+        }
+        return encoladas;
+    }
+    
+    /**
+     * @brief Olvida el estado de un sensor (por ejemplo, antes de eliminarlo)
+     * @param sensor Sensor cuyo estado se descarta
+     */
+    void olvidar(const SensorBase* sensor) {
+        estados.erase(sensor);
+    }
+    
+    const ReglasAlerta& getReglas() const { return reglas; }
+    unsigned long long getEmitidas() const { return emitidas; }
+};
+
+/**
+ * @brief Texto descriptivo de un tipo de alerta
+ * @param tipo Regla disparada
+ * @return Descripcion breve en castellano
+ */
+inline const char* describirAlerta(TipoAlerta tipo) {
+    switch (tipo) {
+        case ALERTA_UMBRAL_SUPERIOR:
+            return "umbral superior excedido";
+        case ALERTA_UMBRAL_INFERIOR:
+            return "umbral inferior excedido";
+        case ALERTA_TASA_CAMBIO:
+            return "variacion brusca";
+        case ALERTA_PUNTAJE_Z:
+            return "valor atipico (puntaje z)";
+        default:
+            return "sensor estancado";
+    }
+}
+
+/**
+ * @class DespachadorAlertas
+ * @brief Hilo consumidor que vacia una cola de alertas hacia la consola
+ * 
+ * El hilo se inicia en el constructor y se detiene en el destructor, tras
+ * despachar las alertas pendientes. Cada alerta se escribe con una unica
+ * operacion para no intercalarse con los mensajes de la ingesta; el nombre
+ * del sensor se traduce aqui, fuera de la ruta de ingesta.
+ */
+class DespachadorAlertas {
+private:
+    ColaSPSC<Alerta>& cola;      ///< Cola a consumir
+    std::atomic<bool> activo;    ///< Indicador de continuidad del hilo
+    std::thread hilo;            ///< Hilo consumidor
+    
+    void despacharPendientes() {
+        Alerta alerta;
+        while (cola.intentarDesencolar(alerta)) {
+            std::ostringstream linea;
+            linea << "[ALERTA] " << TablaIdentificadores::global().nombre(alerta.sensor) << ": "
+                  << describirAlerta(alerta.tipo)
+                  << " (valor " << alerta.valor << ", referencia " << alerta.referencia << ")\n";
+            std::cout << linea.str() << std::flush;
+        }
+    }
+    
+    void ejecutar() {
+        while (activo.load(std::memory_order_acquire)) {
+            despacharPendientes();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        despacharPendientes();
+    }
+    
+public:
+    /**
+     * @brief Inicia el hilo consumidor
+     * @param origen Cola de la que se extraen las alertas
+     */
+    explicit DespachadorAlertas(ColaSPSC<Alerta>& origen)
+        : cola(origen), activo(true), hilo(&DespachadorAlertas::ejecutar, this) {}
+    
+    DespachadorAlertas(const DespachadorAlertas&) = delete;
+    DespachadorAlertas& operator=(const DespachadorAlertas&) = delete;
+    
+    /**
+     * @brief Detiene el hilo tras despachar las alertas pendientes
+     */
+    ~DespachadorAlertas() {
+        activo.store(false, std::memory_order_release);
+        hilo.join();
+    }
+};
+
+#endif // MOTORALERTAS_H
@@ -9,12 +9,231 @@
 #ifndef NODO_H
 #define NODO_H
 
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+struct Nodo;
+
+/**
+ * @struct ElementoTrivial
+ * @brief Indica si T se copia byte a byte y no requiere destructor
+ * 
+ * Es el caso de los historiales numericos (float, int) y de los punteros
+ * del registro: ListaSensor los copia y libera por cadenas enteras.
+ */
+template <typename T>
+struct ElementoTrivial : std::integral_constant<bool, std::is_trivially_copyable<T>::value> {};
+
+/**
+ * @struct ParametroNodo
+ * @brief Forma de recibir un T: por valor si es escalar, por referencia si no
+ */
+template <typename T>
+struct ParametroNodo {
+    typedef typename std::conditional<std::is_scalar<T>::value, T, const T&>::type tipo;
+};
+
+/**
+ * @class PoolNodos
+ * @brief Reserva de memoria por bloques para los nodos de un tipo dado
+ * 
+ * Los nodos se obtienen de bloques contiguos solicitados al sistema de una
+ * sola vez y se reciclan mediante una lista de espacios libres por hilo.
+ * Esto permite reservar millones de nodos con una unica asignacion y evita
+ * una llamada al asignador general por cada insercion.
+ * 
+ * Los bloques no se devuelven al sistema: la memoria liberada queda disponible
+ * para nuevos nodos del mismo tipo durante toda la ejecucion. El total
+ * reservado se contabiliza para comparar con los nodos realmente en uso.
+ * 
+ * @tparam T Tipo de dato de los nodos administrados
+ */
+template <typename T>
+class PoolNodos {
+private:
+    /// Enlace utilizado para encadenar espacios libres
+    struct EspacioLibre {
+        EspacioLibre* siguiente;
+    };
+    
+    /// Estado local de cada hilo
+    struct Estado {
+        EspacioLibre* libres;   ///< Cima de la lista de espacios libres
+        Nodo<T>* cadena;        ///< Nodos devueltos en bloque, aun enlazados por siguiente
+        std::size_t disponibles; ///< Cantidad de espacios libres (incluida la cadena)
+        Estado() : libres(nullptr), cadena(nullptr), disponibles(0) {}
+    };
+    
+    static const std::size_t BLOQUE_MINIMO = 64;  ///< Nodos por bloque en crecimiento normal
+    
+    static Estado& estado() {
+        static thread_local Estado local;
+        return local;
+    }
+    
+    /**
+     * @brief Registra un bloque para que permanezca referenciado
+     * 
+     * Los bloques se conservan en un registro global, compartido entre hilos,
+     * ya que un nodo puede liberarse en un hilo distinto al que lo creo.
+     */
+    static std::atomic<std::size_t>& reservados() {
+        static std::atomic<std::size_t> bytes(0);
+        return bytes;
+    }
+    
+    static void registrarBloque(void* bloque) {
+        static std::mutex cerrojo;
+        static std::vector<void*>* bloques = new std::vector<void*>();
+        std::lock_guard<std::mutex> guardia(cerrojo);
+        bloques->push_back(bloque);
+    }
+    
+    /**
+     * @brief Solicita un bloque contiguo y lo encadena a los espacios libres
+     * @param cantidad Numero de nodos del bloque
+     * 
+     * Los espacios se encadenan en orden ascendente de direccion para que
+     * los nodos consecutivos de una lista queden contiguos en memoria.
+     */
+    static void reponer(Estado& local, std::size_t cantidad) {
+        const std::size_t tamNodo = sizeof(Nodo<T>);
+        char* bloque = static_cast<char*>(::operator new(cantidad * tamNodo));
+        registrarBloque(bloque);
+        reservados().fetch_add(cantidad * tamNodo, std::memory_order_relaxed);
+        
+        for (std::size_t i = 0; i + 1 < cantidad; i++) {
+            reinterpret_cast<EspacioLibre*>(bloque + i * tamNodo)->siguiente =
+                reinterpret_cast<EspacioLibre*>(bloque + (i + 1) * tamNodo);
+        }
+        reinterpret_cast<EspacioLibre*>(bloque + (cantidad - 1) * tamNodo)->siguiente = local.libres;
+        local.libres = reinterpret_cast<EspacioLibre*>(bloque);
+        local.disponibles += cantidad;
+    }
+    
+    /**
+     * @brief Toma un espacio de los libres, de la cadena devuelta o de un bloque nuevo
+     */
+    static void* extraer(Estado& local) {
+        if (local.libres == nullptr && local.cadena == nullptr) {
+            reponer(local, BLOQUE_MINIMO);
+        }
+        local.disponibles--;
+        if (local.libres != nullptr) {
+            EspacioLibre* espacio = local.libres;
+            local.libres = espacio->siguiente;
+            return espacio;
+        }
+        Nodo<T>* nodo = local.cadena;
+        local.cadena = nodo->siguiente;
+        return nodo;
+    }
+    
+public:
+    /**
+     * @brief Obtiene espacio para un nodo
+     * @return Puntero a memoria sin inicializar de tamanio sizeof(Nodo<T>)
+     */
+    static void* obtener() {
+        return extraer(estado());
+    }
+    
+    /**
+     * @brief Obtiene espacio para varios nodos y los encadena por siguiente
+     * @tparam Inicializador Funcion void(Nodo<T>*) que escribe el dato de cada nodo
+     * @param cantidad Nodos solicitados (al menos 1)
+     * @param cola Recibe el ultimo nodo, cuyo siguiente queda en nullptr
+     * @param inicializar Se invoca una vez por nodo, en orden
+     * @return Primer nodo de la cadena
+     * 
+     * El pool no construye los nodos: pensado para tipos con ElementoTrivial,
+     * cuyo dato puede escribirse byte a byte. Obtener e inicializar en la
+     * misma pasada evita recorrer la cadena dos veces.
+     */
+    template <typename Inicializador>
+    static Nodo<T>* obtenerCadena(std::size_t cantidad, Nodo<T>*& cola, Inicializador inicializar) {
+        Estado& local = estado();
+        if (local.disponibles < cantidad) {
+            reponer(local, cantidad - local.disponibles);
+        }
+        Nodo<T>* cabeza = static_cast<Nodo<T>*>(extraer(local));
+        inicializar(cabeza);
+        cola = cabeza;
+        for (std::size_t i = 1; i < cantidad; i++) {
+            Nodo<T>* nuevo = static_cast<Nodo<T>*>(extraer(local));
+            inicializar(nuevo);
+            cola->siguiente = nuevo;
+            cola = nuevo;
+        }
+        cola->siguiente = nullptr;
+        return cabeza;
+    }
+    
+    /**
+     * @brief Devuelve el espacio de un nodo a la lista de libres
+     * @param espacio Memoria previamente obtenida con obtener()
+     */
+    static void devolver(void* espacio) {
+        Estado& local = estado();
+        EspacioLibre* libre = static_cast<EspacioLibre*>(espacio);
+        libre->siguiente = local.libres;
+        local.libres = libre;
+        local.disponibles++;
+    }
+    
+    /**
+     * @brief Devuelve de una vez una cadena de nodos sin destruirlos
+     * @param cabeza Primer nodo de la cadena
+     * @param cola Ultimo nodo de la cadena
+     * @param cantidad Nodos de la cadena
+     * 
+     * Opera en tiempo constante: la cadena se conserva tal cual y obtener()
+     * la consume nodo a nodo siguiendo sus enlaces. Solo es valido si T no
+     * requiere destructor (ElementoTrivial).
+     */
+    static void devolverCadena(Nodo<T>* cabeza, Nodo<T>* cola, std::size_t cantidad) {
+        Estado& local = estado();
+        cola->siguiente = local.cadena;
+        local.cadena = cabeza;
+        local.disponibles += cantidad;
+    }
+    
+    /**
+     * @brief Garantiza espacio libre para una cantidad de nodos
+     * @param cantidad Numero de nodos que se insertaran a continuacion
+     * 
+     * Si los espacios libres no alcanzan, solicita el faltante en un unico
+     * bloque contiguo.
+     */
+    static void reservar(std::size_t cantidad) {
+        Estado& local = estado();
+        if (local.disponibles < cantidad) {
+            reponer(local, cantidad - local.disponibles);
+        }
+    }
+    
+    /**
+     * @brief Memoria solicitada al sistema por todos los hilos
+     * @return Bytes de todos los bloques, ocupados o libres
+     */
+    static std::size_t getBytesReservados() {
+        return reservados().load(std::memory_order_relaxed);
+    }
+};
+
 /**
  * @struct Nodo
  * @brief Estructura fundamental de elemento enlazado generico
  * 
  * Representa un nodo individual en una lista enlazada simple.
  * Utiliza plantillas (templates) para lograr independencia del tipo de dato.
+ * La memoria de cada nodo proviene de PoolNodos, de modo que new y delete
+ * se mantienen en el codigo cliente sin pasar por el asignador general.
  * 
  * @tparam T Tipo de dato que almacenara el nodo
  */
@@ -29,7 +248,31 @@ struct Nodo {
      * 
      * Crea un nuevo nodo con el contenido especificado y puntero siguiente nulo.
      */
-    Nodo(T contenido) : dato(contenido), siguiente(nullptr) {}
+    Nodo(typename ParametroNodo<T>::tipo contenido) : dato(contenido), siguiente(nullptr) {}
+    
+    /**
+     * @brief Asignacion de memoria desde el pool del tipo
+     */
+    static void* operator new(std::size_t tamanio) {
+        if (tamanio != sizeof(Nodo<T>)) {
+            return ::operator new(tamanio);
+        }
+        return PoolNodos<T>::obtener();
+    }
+    
+    /**
+     * @brief Liberacion de memoria hacia el pool del tipo
+     */
+    static void operator delete(void* espacio, std::size_t tamanio) {
+        if (espacio == nullptr) {
+            return;
+        }
+        if (tamanio != sizeof(Nodo<T>)) {
+            ::operator delete(espacio);
+            return;
+        }
+        PoolNodos<T>::devolver(espacio);
+    }
 };
 
 #endif // NODO_H
@@ -0,0 +1,148 @@
+/**
+ * @file ReclamacionEpocas.h
+ * @brief Reclamacion de memoria por epocas para estructuras sin cerrojos
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef RECLAMACIONEPOCAS_H
+#define RECLAMACIONEPOCAS_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+
+/**
+ * @class DominioEpocas
+ * @brief Registro de las epocas anunciadas por los hilos que recorren una estructura
+ * 
+ * Quien recorre la estructura toma una Guarda, que anuncia la epoca global
+ * vigente en una ranura propia. Quien desenlaza un nodo lo etiqueta con
+ * retirar() y lo libera cuando su etiqueta es menor que epocaSegura(): a
+ * partir de ese momento ningun recorrido activo comenzo antes del retiro.
+ * La epoca avanza una vez por recoleccion (en epocaSegura), no por nodo,
+ * de modo que retirar no escribe en la linea compartida de epocaGlobal.
+ * Guardar y liberar los nodos retirados queda a cargo de la estructura.
+ */
+class DominioEpocas {
+public:
+    static const int MAX_PARTICIPANTES = 64;  ///< Guardas simultaneas admitidas
+    
+private:
+    static const std::size_t LINEA_CACHE = 64;  ///< Tamanio de linea de cache supuesto
+    
+    /**
+     * @struct Ranura
+     * @brief Epoca anunciada por un recorrido en curso (0 = ninguno)
+     * 
+     * Cada ranura ocupa su propia linea de cache para que los hilos
+     * no se disputen la misma linea al entrar y salir.
+     */
+    struct alignas(LINEA_CACHE) Ranura {
+        std::atomic<bool> ocupada;              ///< Reservada por una guarda
+        std::atomic<unsigned long long> epoca;  ///< Epoca en que comenzo el recorrido
+        
+        Ranura() : ocupada(false), epoca(0) {}
+    };
+    
+    alignas(LINEA_CACHE) std::atomic<unsigned long long> epocaGlobal;  ///< Epoca vigente (comienza en 1)
+    Ranura ranuras[MAX_PARTICIPANTES];                                 ///< Epocas anunciadas
+    
+    DominioEpocas(const DominioEpocas&);
+    DominioEpocas& operator=(const DominioEpocas&);
+    
+    /**
+     * @brief Reserva una ranura y anuncia en ella la epoca vigente
+     * @return Indice de la ranura
+     * 
+     * La busqueda empieza en una ranura derivada del hilo, de modo que
+     * hilos distintos no compitan por las primeras.
+     */
+    int entrar() {
+        static thread_local std::size_t pista =
+            std::hash<std::thread::id>()(std::this_thread::get_id());
+        int indice = -1;
+        for (std::size_t intento = 0; indice < 0; intento++) {
+            const int candidata = static_cast<int>((pista + intento) % MAX_PARTICIPANTES);
+            bool libre = false;
+            if (!ranuras[candidata].ocupada.load(std::memory_order_relaxed) &&
+                ranuras[candidata].ocupada.compare_exchange_strong(libre, true, std::memory_order_acquire)) {
+                indice = candidata;
+            } else if (intento % MAX_PARTICIPANTES == MAX_PARTICIPANTES - 1) {
+                std::this_thread::yield();
+            }
+        }
+        // Si la epoca avanzo entre la lectura y el anuncio, quien la avanzo
+        // pudo no ver esta ranura: se anuncia de nuevo con la epoca nueva
+        unsigned long long epoca;
+        do {
+            epoca = epocaGlobal.load();
+            ranuras[indice].epoca.store(epoca);
+        } while (epocaGlobal.load() != epoca);
+        return indice;
+    }
+    
+    void salir(int indice) {
+        ranuras[indice].epoca.store(0, std::memory_order_release);
+        ranuras[indice].ocupada.store(false, std::memory_order_release);
+    }
+    
+public:
+    /**
+     * @class Guarda
+     * @brief Recorrido protegido (RAII)
+     * 
+     * Mientras exista, ningun nodo que el recorrido pueda alcanzar se
+     * libera. Debe vivir poco: retiene la memoria de todo lo que se
+     * retire mientras tanto.
+     */
+    class Guarda {
+    private:
+        DominioEpocas& dominio;  ///< Dominio en que se anuncio la epoca
+        int ranura;              ///< Ranura reservada
+        
+        Guarda(const Guarda&);
+        Guarda& operator=(const Guarda&);
+        
+    public:
+        explicit Guarda(DominioEpocas& origen) : dominio(origen), ranura(origen.entrar()) {}
+        ~Guarda() { dominio.salir(ranura); }
+        
+        /**
+         * @brief Ranura reservada, exclusiva mientras viva la guarda
+         */
+        int getRanura() const { return ranura; }
+    };
+    
+    DominioEpocas() : epocaGlobal(1) {}
+    
+    /**
+     * @brief Etiqueta un nodo ya desenlazado
+     * @return Epoca con la que debe guardarse el nodo retirado
+     */
+    unsigned long long retirar() const {
+        return epocaGlobal.load();
+    }
+    
+    /**
+     * @brief Avanza la epoca y calcula la cota para liberar
+     * @return Cota: los retirados con epoca menor ya no son alcanzables
+     * 
+     * Todo lo retirado antes de la llamada queda con una epoca menor que
+     * la nueva, asi que sin recorridos activos se libera por completo.
+     */
+    unsigned long long epocaSegura() {
+        unsigned long long minima = epocaGlobal.fetch_add(1) + 1;
+        for (int i = 0; i < MAX_PARTICIPANTES; i++) {
+            const unsigned long long epoca = ranuras[i].epoca.load();
+            if (epoca != 0 && epoca < minima) {
+                minima = epoca;
+            }
+        }
+        return minima;
+    }
+};
+
+#endif // RECLAMACIONEPOCAS_H
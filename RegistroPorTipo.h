@@ -0,0 +1,157 @@
+/**
+ * @file RegistroPorTipo.h
+ * @brief Registro de sensores en almacenes contiguos, uno por tipo concreto
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef REGISTROPORTIPO_H
+#define REGISTROPORTIPO_H
+
+#include "SensorTemperatura.h"
+#include "SensorPresion.h"
+#include "Bitacora.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class RegistroPorTipo
+ * @brief Alternativa a ColeccionSensores para analisis por lotes
+ * 
+ * Guarda los sensores por valor en un vector por tipo concreto en lugar
+ * de punteros a objetos dispersos en el heap. Los recorridos visitan cada
+ * vector en orden de memoria y, como las clases concretas son final, las
+ * llamadas se resuelven en compilacion y pueden expandirse en linea.
+ * 
+ * Las referencias a sensores se invalidan cuando un vector crece; reservar()
+ * evita el crecimiento si la cantidad se conoce de antemano. Para consumidores
+ * polimorficos, iterar() entrega cada sensor como SensorBase&.
+ */
+class RegistroPorTipo {
+private:
+    std::vector<SensorTemperatura> termicos;  ///< Sensores termicos contiguos
+    std::vector<SensorPresion> presiones;     ///< Sensores barometricos contiguos
+    
+    /**
+     * @brief Duplica la capacidad de un almacen lleno antes de insertar
+     * 
+     * Los sensores trasladados durante el crecimiento se destruyen vacios;
+     * el silencio evita que la bitacora los reporte como eliminados.
+     */
+    template <typename Sensor>
+    static void prepararInsercion(std::vector<Sensor>& almacen) {
+        if (almacen.size() == almacen.capacity()) {
+            SilencioBitacora silencio;
+            almacen.reserve(almacen.empty() ? 16 : 2 * almacen.capacity());
+        }
+    }
+    
+public:
+    RegistroPorTipo() {}
+    RegistroPorTipo(const RegistroPorTipo&) = delete;
+    RegistroPorTipo& operator=(const RegistroPorTipo&) = delete;
+    
+    /**
+     * @brief Reserva espacio para evitar traslados durante la carga
+     * @param cantidadTermicos Sensores termicos esperados
+     * @param cantidadPresiones Sensores de presion esperados
+     */
+    void reservar(std::size_t cantidadTermicos, std::size_t cantidadPresiones) {
+        SilencioBitacora silencio;
+        termicos.reserve(cantidadTermicos);
+        presiones.reserve(cantidadPresiones);
+    }
+    
+    /**
+     * @brief Crea un sensor termico al final de su almacen
+     * @param identificador Codigo unico del sensor
+     * @return Referencia valida hasta el proximo crecimiento del almacen
+     */
+    SensorTemperatura& agregarTermico(const char* identificador) {
+        prepararInsercion(termicos);
+        termicos.emplace_back(identificador);
+        return termicos.back();
+    }
+    
+    /**
+     * @brief Crea un sensor de presion al final de su almacen
+     * @param identificador Codigo unico del sensor
+     * @return Referencia valida hasta el proximo crecimiento del almacen
+     */
+    SensorPresion& agregarPresion(const char* identificador) {
+        prepararInsercion(presiones);
+        presiones.emplace_back(identificador);
+        return presiones.back();
+    }
+    
+    /**
+     * @brief Recorre los sensores termicos con despacho estatico
+     * @tparam Operacion Funcion invocada como operacion(SensorTemperatura&)
+     */
+    template <typename Operacion>
+    void iterarTermicos(Operacion operacion) {
+        for (std::size_t i = 0; i < termicos.size(); i++) {
+            operacion(termicos[i]);
+        }
+    }
+    
+    /**
+     * @brief Recorre los sensores de presion con despacho estatico
+     * @tparam Operacion Funcion invocada como operacion(SensorPresion&)
+     */
+    template <typename Operacion>
+    void iterarPresiones(Operacion operacion) {
+        for (std::size_t i = 0; i < presiones.size(); i++) {
+            operacion(presiones[i]);
+        }
+    }
+    
+    /**
+     * @brief Aplica un visitante con una sobrecarga por tipo concreto
+     * @tparam Visitante Objeto con operator()(SensorTemperatura&) y operator()(SensorPresion&)
+     * @param visitante Visitante a aplicar; conserva su estado entre llamadas
+     */
+    template <typename Visitante>
+    void visitar(Visitante& visitante) {
+        for (std::size_t i = 0; i < termicos.size(); i++) {
+            visitante(termicos[i]);
+        }
+        for (std::size_t i = 0; i < presiones.size(); i++) {
+            visitante(presiones[i]);
+        }
+    }
+    
+    /**
+     * @brief Recorre todos los sensores a traves de la interfaz comun
+     * @tparam Operacion Funcion invocada como operacion(SensorBase&)
+     */
+    template <typename Operacion>
+    void iterar(Operacion operacion) {
+        for (std::size_t i = 0; i < termicos.size(); i++) {
+            operacion(static_cast<SensorBase&>(termicos[i]));
+        }
+        for (std::size_t i = 0; i < presiones.size(); i++) {
+            operacion(static_cast<SensorBase&>(presiones[i]));
+        }
+    }
+    
+    /**
+     * @brief Ejecuta procesarLectura en todos los sensores, tipo por tipo
+     */
+    void procesarTodos() {
+        for (std::size_t i = 0; i < termicos.size(); i++) {
+            termicos[i].procesarLectura();
+        }
+        for (std::size_t i = 0; i < presiones.size(); i++) {
+            presiones[i].procesarLectura();
+        }
+    }
+    
+    std::size_t getCantidadTermicos() const { return termicos.size(); }
+    std::size_t getCantidadPresiones() const { return presiones.size(); }
+    std::size_t getTamanio() const { return termicos.size() + presiones.size(); }
+    bool estaVacio() const { return termicos.empty() && presiones.empty(); }
+};
+
+#endif // REGISTROPORTIPO_H
@@ -0,0 +1,117 @@
+/**
+ * @file RegistroSensores.h
+ * @brief Registro duenio de los sensores de una coleccion
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef REGISTROSENSORES_H
+#define REGISTROSENSORES_H
+
+#include "ColeccionSensores.h"
+#include "SensorPresion.h"
+#include "SensorTemperatura.h"
+
+/**
+ * @class RegistroSensores
+ * @brief Propietario unico de los sensores de una ColeccionSensores
+ * 
+ * Crea los sensores, los enlaza en una ColeccionSensores que sigue
+ * sirviendo a las consultas, la ingesta y las instantaneas, y los libera al
+ * retirarlos, al llamar a vaciar() o al destruirse. Centraliza asi el
+ * recorrido con delete que antes repetia cada punto de cierre.
+ * 
+ * getColeccion() entrega una vista de solo lectura: las altas y bajas
+ * pasan por el registro, igual que las busquedas que reordenan la
+ * coleccion segun la politica de busqueda (buscarSi).
+ */
+class RegistroSensores {
+private:
+    ColeccionSensores coleccion;  ///< Sensores registrados, en orden de alta
+    
+public:
+    RegistroSensores() {}
+    
+    RegistroSensores(const RegistroSensores&) = delete;
+    RegistroSensores& operator=(const RegistroSensores&) = delete;
+    
+    /**
+     * @brief Destructor: libera todos los sensores
+     */
+    ~RegistroSensores() {
+        vaciar();
+    }
+    
+    /**
+     * @brief Crea un sensor termico y lo agrega al final de la coleccion
+     * @param identificador Codigo unico del sensor
+     * @return Sensor creado, valido hasta retirarlo o vaciar el registro
+     */
+    SensorTemperatura* agregarTermico(const char* identificador) {
+        SensorTemperatura* dispositivo = new SensorTemperatura(identificador);
+        coleccion.insertarAlFinal(dispositivo);
+        return dispositivo;
+    }
+    
+    /**
+     * @brief Crea un sensor de presion y lo agrega al final de la coleccion
+     * @param identificador Codigo unico del sensor
+     * @return Sensor creado, valido hasta retirarlo o vaciar el registro
+     */
+    SensorPresion* agregarPresion(const char* identificador) {
+        SensorPresion* dispositivo = new SensorPresion(identificador);
+        coleccion.insertarAlFinal(dispositivo);
+        return dispositivo;
+    }
+    
+    /**
+     * @brief Desenlaza un sensor y lo libera
+     * @param dispositivo Sensor creado por este registro
+     * @return true si el sensor estaba registrado
+     */
+    bool retirar(SensorBase* dispositivo) {
+        if (!coleccion.eliminar(dispositivo)) {
+            return false;
+        }
+        delete dispositivo;
+        return true;
+    }
+    
+    /**
+     * @brief Libera todos los sensores y deja la coleccion vacia
+     * 
+     * Cada sensor se libera en el mismo recorrido que devuelve su nodo.
+     */
+    void vaciar() {
+        coleccion.vaciar([](SensorBase* dispositivo) {
+            delete dispositivo;
+        });
+    }
+    
+    /**
+     * @brief Busca el primer sensor que cumple una condicion
+     * @tparam Predicado Invocable con firma bool(const SensorBase*)
+     * @return Sensor encontrado, o nullptr si ninguno cumple
+     * 
+     * Aplica la politica de busqueda vigente, que puede reordenar la coleccion.
+     */
+    template <typename Predicado>
+    SensorBase* buscarSi(Predicado predicado) {
+        Nodo<SensorBase*>* localizado = coleccion.buscarSi(predicado);
+        return localizado == nullptr ? nullptr : localizado->dato;
+    }
+    
+    void setPoliticaBusqueda(PoliticaBusqueda nueva) { coleccion.setPoliticaBusqueda(nueva); }
+    PoliticaBusqueda getPoliticaBusqueda() const { return coleccion.getPoliticaBusqueda(); }
+    
+    /**
+     * @brief Vista de solo lectura de la coleccion; las altas y bajas pasan por el registro
+     */
+    const ColeccionSensores* getColeccion() const { return &coleccion; }
+    
+    int getTamanio() const { return coleccion.getTamanio(); }
+    bool estaVacio() const { return coleccion.estaVacia(); }
+};
+
+#endif // REGISTROSENSORES_H
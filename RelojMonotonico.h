@@ -0,0 +1,50 @@
+/**
+ * @file RelojMonotonico.h
+ * @brief Fuente de marcas de tiempo monotonicas para las mediciones
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef RELOJMONOTONICO_H
+#define RELOJMONOTONICO_H
+
+#include <chrono>
+#include <cstdint>
+
+/// Marca de tiempo en milisegundos de un reloj monotonico
+typedef int64_t MarcaTiempo;
+
+/**
+ * @class RelojMonotonico
+ * @brief Reloj que nunca retrocede, independiente de ajustes de hora del sistema
+ * 
+ * La resolucion de milisegundos mantiene pequenas las diferencias entre
+ * mediciones consecutivas, lo que favorece la compresion de los historiales.
+ */
+class RelojMonotonico {
+public:
+    /**
+     * @brief Obtiene la marca de tiempo actual
+     * @return Milisegundos transcurridos desde un origen fijo del reloj
+     */
+    static MarcaTiempo ahora() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    
+    /**
+     * @brief Hora del sistema, para anclar las marcas fuera del proceso
+     * @return Milisegundos desde la epoca Unix segun el reloj del sistema
+     * 
+     * El origen del reloj monotonico cambia con cada arranque del equipo;
+     * un par (ahora(), sistema()) tomado en el mismo instante permite
+     * trasladar marcas guardadas al reloj monotonico de otro proceso.
+     */
+    static int64_t sistema() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+};
+
+#endif // RELOJMONOTONICO_H
@@ -0,0 +1,117 @@
+/**
+ * @file ResumenRango.h
+ * @brief Agregados de las mediciones de un intervalo de tiempo
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef RESUMENRANGO_H
+#define RESUMENRANGO_H
+
+#include <cstddef>
+#include <limits>
+
+/**
+ * @struct ResumenRango
+ * @brief Cantidad, minimo, maximo y suma de un conjunto de mediciones
+ * 
+ * Se construye incorporando mediciones individuales o combinando los
+ * resumenes ya calculados de bloques completos.
+ */
+struct ResumenRango {
+    long long cantidad;  ///< Mediciones incluidas
+    double minimo;       ///< Menor medicion incluida
+    double maximo;       ///< Mayor medicion incluida
+    double suma;         ///< Suma de las mediciones incluidas
+    
+    ResumenRango()
+        : cantidad(0), minimo(std::numeric_limits<double>::infinity()),
+          maximo(-std::numeric_limits<double>::infinity()), suma(0.0) {}
+    
+    /**
+     * @brief Incorpora una medicion individual
+     * @param valor Medicion a incorporar
+     */
+    void incorporar(double valor) {
+        cantidad++;
+        suma += valor;
+        if (valor < minimo) {
+            minimo = valor;
+        }
+        if (valor > maximo) {
+            maximo = valor;
+        }
+    }
+    
+    /**
+     * @brief Combina los agregados de otro conjunto de mediciones
+     * @param otro Resumen a combinar
+     */
+    void combinar(const ResumenRango& otro) {
+        if (otro.cantidad == 0) {
+            return;
+        }
+        cantidad += otro.cantidad;
+        suma += otro.suma;
+        if (otro.minimo < minimo) {
+            minimo = otro.minimo;
+        }
+        if (otro.maximo > maximo) {
+            maximo = otro.maximo;
+        }
+    }
+    
+    /**
+     * @brief Media aritmetica de las mediciones incluidas
+     * @return Media, o 0 si el resumen esta vacio
+     */
+    double media() const {
+        return cantidad > 0 ? suma / static_cast<double>(cantidad) : 0.0;
+    }
+};
+
+/**
+ * @brief Suma, minimo y maximo de un arreglo de mediciones en una pasada
+ * @tparam Acumulado Tipo de la suma (long long para enteros, double para decimales)
+ * @param valores Arreglo de origen (al menos un elemento)
+ * @param cantidad Numero de elementos del arreglo
+ * @param suma Recibe la suma de los valores
+ * @param minimo Recibe el menor valor
+ * @param maximo Recibe el mayor valor
+ * 
+ * Recorre el arreglo con cuatro acumuladores independientes, lo que
+ * rompe la dependencia entre iteraciones y permite al compilador
+ * vectorizar el ciclo. Para decimales, la suma puede diferir en el
+ * redondeo de la suma elemento por elemento.
+ */
+template <typename Acumulado, typename T>
+void acumularBloque(const T* valores, std::size_t cantidad, Acumulado& suma, T& minimo, T& maximo) {
+    const std::size_t CARRILES = 4;
+    Acumulado parciales[CARRILES] = { 0, 0, 0, 0 };
+    T menores[CARRILES] = { valores[0], valores[0], valores[0], valores[0] };
+    T mayores[CARRILES] = { valores[0], valores[0], valores[0], valores[0] };
+    std::size_t i = 0;
+    for (; i + CARRILES <= cantidad; i += CARRILES) {
+        for (std::size_t c = 0; c < CARRILES; c++) {
+            const T valor = valores[i + c];
+            parciales[c] += valor;
+            menores[c] = valor < menores[c] ? valor : menores[c];
+            mayores[c] = mayores[c] < valor ? valor : mayores[c];
+        }
+    }
+    for (; i < cantidad; i++) {
+        parciales[0] += valores[i];
+        menores[0] = valores[i] < menores[0] ? valores[i] : menores[0];
+        mayores[0] = mayores[0] < valores[i] ? valores[i] : mayores[0];
+    }
+    suma = (parciales[0] + parciales[1]) + (parciales[2] + parciales[3]);
+    minimo = menores[0];
+    maximo = mayores[0];
+    for (std::size_t c = 1; c < CARRILES; c++) {
+        minimo = menores[c] < minimo ? menores[c] : minimo;
+        maximo = maximo < mayores[c] ? mayores[c] : maximo;
+    }
+}
+
+#endif // RESUMENRANGO_H
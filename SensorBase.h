@@ -9,8 +9,26 @@
 #ifndef SENSORBASE_H
 #define SENSORBASE_H
 
+#include "Bitacora.h"
+#include "RelojMonotonico.h"
+#include "ResumenRango.h"
+#include "TablaIdentificadores.h"
+#include "UsoMemoria.h"
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
-#include <cstring>
+
+/**
+ * @enum TipoSensor
+ * @brief Etiqueta compacta del tipo concreto de un sensor
+ * 
+ * Los valores coinciden con el caracter que identifica al tipo en el
+ * protocolo serial y en las instantaneas.
+ */
+enum TipoSensor : uint8_t {
+    SENSOR_TEMPERATURA = 'T',  ///< SensorTemperatura
+    SENSOR_PRESION = 'P'       ///< SensorPresion
+};
 
 /**
  * @class SensorBase
@@ -19,22 +37,47 @@
  * Establece la interfaz comun que deben implementar todos los sensores
  * del sistema. Utiliza polimorfismo para permitir el manejo uniforme
  * de diferentes tipos de sensores.
+ * 
+ * Cada sensor lleva una etiqueta TipoSensor fijada al construirlo, de modo
+ * que el tipo concreto se resuelve con una comparacion en lugar de una
+ * conversion dinamica.
+ * 
+ * El nombre se guarda como un identificador de TablaIdentificadores, por lo
+ * que comparar sensores por nombre es una igualdad entre enteros.
  */
 class SensorBase {
 protected:
-    char nombre[50];  ///< Cadena identificadora del dispositivo
+    IdSensor identificador;  ///< Nombre internado del dispositivo
+    const TipoSensor tipo;   ///< Tipo concreto del sensor
     
 public:
+    static const int CANTIDAD_VENTANAS = 3;  ///< Ventanas moviles por sensor (1, 5 y 15 minutos)
+    
+    /**
+     * @brief Duracion de una ventana movil
+     * @param indice Posicion de la ventana (0 a CANTIDAD_VENTANAS - 1)
+     * @return Ancho de la ventana en milisegundos
+     */
+    static MarcaTiempo duracionVentana(int indice) {
+        switch (indice) {
+            case 0:
+                return 60 * 1000;
+            case 1:
+                return 5 * 60 * 1000;
+            default:
+                return 15 * 60 * 1000;
+        }
+    }
+    
     /**
      * @brief Constructor parametrizado
-     * @param identificador Nombre o codigo del sensor (maximo 49 caracteres)
+     * @param tipoSensor Etiqueta del tipo concreto
+     * @param nombre Nombre o codigo del sensor (maximo 49 caracteres)
      * 
      * Inicializa el sensor con un identificador unico.
      */
-    SensorBase(const char* identificador = "DISPOSITIVO") {
-        std::strncpy(nombre, identificador, 49);
-        nombre[49] = '\0';
-    }
+    SensorBase(TipoSensor tipoSensor, const char* nombre = "DISPOSITIVO")
+        : identificador(TablaIdentificadores::global().internar(nombre)), tipo(tipoSensor) {}
     
     /**
      * @brief Destructor virtual
@@ -43,7 +86,9 @@ public:
      * punteros a la clase base.
      */
     virtual ~SensorBase() {
-        std::cout << "[Eliminacion] Dispositivo finalizado: " << nombre << std::endl;
+        if (Bitacora::activa()) {
+            std::cout << "[Eliminacion] Dispositivo finalizado: " << getNombre() << std::endl;
+        }
     }
     
     /**
@@ -62,12 +107,121 @@ public:
      */
     virtual void imprimirInfo() const = 0;
     
+    /**
+     * @brief Metodo virtual puro para persistencia del estado
+     * @param salida Flujo binario de destino
+     * @return true si la escritura fue exitosa, false en caso contrario
+     * 
+     * Debe escribir el historial de mediciones del sensor en formato binario.
+     * El identificador y el tipo los escribe quien invoca este metodo.
+     */
+    virtual bool guardarEstado(std::ostream& salida) const = 0;
+    
+    /**
+     * @brief Metodo virtual puro para restauracion del estado
+     * @param entrada Flujo binario de origen
+     * @return true si la lectura fue exitosa, false en caso contrario
+     * 
+     * Debe leer el formato producido por guardarEstado y agregarlo
+     * al historial del sensor.
+     */
+    virtual bool cargarEstado(std::istream& entrada) = 0;
+    
+    /**
+     * @brief Metodo virtual puro para trasladar las marcas del historial
+     * @param desplazamiento Milisegundos a sumar a cada marca
+     * 
+     * Lo invoca Instantanea tras cargarEstado para llevar las marcas del
+     * reloj monotonico del proceso que guardo al del proceso actual. Las
+     * ventanas moviles no se persisten, por lo que no se trasladan.
+     */
+    virtual void desplazarMarcas(MarcaTiempo desplazamiento) = 0;
+    
+    /**
+     * @brief Metodo virtual puro para consultas por intervalo de tiempo
+     * @param desde Marca de tiempo inicial (incluida)
+     * @param hasta Marca de tiempo final (excluida)
+     * @return Cantidad, minimo, maximo y suma de las mediciones del intervalo
+     * 
+     * Las marcas provienen de RelojMonotonico. Las implementaciones deben
+     * localizar el intervalo por busqueda binaria, sin recorrer el
+     * historial completo.
+     */
+    virtual ResumenRango consultarRango(MarcaTiempo desde, MarcaTiempo hasta) const = 0;
+    
+    /**
+     * @brief Metodo virtual puro para consultar una ventana movil
+     * @param indice Posicion de la ventana (0 a CANTIDAD_VENTANAS - 1)
+     * @param ahora Instante en que termina la ventana
+     * @return Cantidad, minimo, maximo y suma de la ventana
+     * 
+     * Las ventanas se actualizan en cada medicion nueva; la consulta solo
+     * descarta las mediciones vencidas, en tiempo constante amortizado.
+     */
+    virtual ResumenRango consultarVentana(int indice, MarcaTiempo ahora) = 0;
+    
+    /**
+     * @brief Metodo virtual puro para estimar percentiles
+     * @param q Fraccion acumulada buscada (0.5 mediana, 0.99 percentil 99)
+     * @return Valor estimado del cuantil, o 0 si no hay mediciones
+     * 
+     * La estimacion proviene de un boceto de memoria acotada actualizado
+     * en cada medicion, sin ordenar el historial.
+     */
+    virtual double estimarCuantil(double q) const = 0;
+    
+    /**
+     * @brief Metodo virtual puro de ingesta independiente del tipo
+     * @param valor Medicion en la unidad del sensor
+     * @param marca Instante de la medicion segun RelojMonotonico
+     * 
+     * Cada tipo convierte el valor a su representacion y lo agrega como
+     * agregarLectura, con una sola llamada indirecta.
+     */
+    virtual void agregarLecturaGenerica(double valor, MarcaTiempo marca) = 0;
+    
+    /**
+     * @brief Metodo virtual puro para contar mediciones
+     * @return Mediciones registradas por el sensor, recientes y compactadas
+     */
+    virtual long long getCantidadMediciones() const = 0;
+    
+    /**
+     * @brief Metodo virtual puro para contabilizar la memoria del sensor
+     * @return Bytes actuales y maximos, desglosados por nivel, y nodos de la lista reciente
+     */
+    virtual UsoMemoria getUsoMemoria() const = 0;
+    
+    /**
+     * @brief Memoria total actual del sensor
+     * @return Bytes del objeto, sus niveles de historial, ventanas y boceto
+     */
+    std::size_t bytesOcupados() const {
+        return getUsoMemoria().bytes;
+    }
+    
     /**
      * @brief Obtiene el identificador del sensor
      * @return Puntero constante a la cadena del nombre
      */
     const char* getNombre() const {
-        return nombre;
+        return TablaIdentificadores::global().nombre(identificador);
+    }
+    
+    /**
+     * @brief Obtiene el nombre internado del sensor
+     * @return Identificador compartido por todos los sensores con el mismo nombre
+     */
+    IdSensor getId() const {
+        return identificador;
+    }
+    
+    /**
+     * @brief Obtiene la etiqueta del tipo concreto
+     * @return SENSOR_TEMPERATURA o SENSOR_PRESION
+     */
+    TipoSensor getTipo() const {
+        return tipo;
     }
 };
 
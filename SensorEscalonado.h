@@ -0,0 +1,412 @@
+/**
+ * @file SensorEscalonado.h
+ * @brief Base comun de los sensores con historial en dos niveles
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef SENSORESCALONADO_H
+#define SENSORESCALONADO_H
+
+#include "SensorBase.h"
+#include "ListaSensor.h"
+#include "Instrumentacion.h"
+#include "RelojMonotonico.h"
+#include "FormatoBinario.h"
+#include "VentanasDeslizantes.h"
+#include "BocetoCuantiles.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * @class SensorEscalonado
+ * @brief Historial reciente, historial comprimido y agregados de un sensor
+ * 
+ * Las mediciones recientes se guardan en una ListaSensor<T> con sus marcas
+ * de tiempo y, al alcanzar el limite configurado, se compactan en el
+ * historial comprimido (Archivo). Cada medicion alimenta ademas las
+ * ventanas moviles y el boceto de percentiles.
+ * 
+ * La clase derivada define el procesamiento y la presentacion propios de
+ * su tipo, y ademas:
+ * - static const char* etiquetaBitacora(): prefijo de sus mensajes
+ * - static const char* descripcionValores(): nombre de los valores en plural
+ * - void informarLectura(T medida) const: mensaje de una medicion
+ * - void archivarRecientes(): codifica la lista reciente en el Archivo
+ * 
+ * @tparam Derivado Sensor concreto (final)
+ * @tparam T Tipo de las mediciones
+ * @tparam Archivo Historial comprimido de mediciones de tipo T
+ * @tparam Acumulado Tipo de las sumas de las ventanas moviles
+ */
+template <typename Derivado, typename T, typename Archivo, typename Acumulado = double>
+class SensorEscalonado : public SensorBase {
+protected:
+    ListaSensor<T>* registroMediciones;        ///< Coleccion de mediciones recientes
+    std::vector<MarcaTiempo> marcasRecientes;  ///< Marcas de tiempo de registroMediciones
+    Archivo archivoComprimido;                 ///< Mediciones compactadas
+    mutable std::size_t picoBytes;             ///< Mayor memoria total observada
+    int limiteReciente;                        ///< Mediciones recientes antes de compactar (0 = nunca)
+    /// Agregados moviles de 1, 5 y 15 minutos sobre un buffer comun de mediciones
+    VentanasDeslizantes<T, CANTIDAD_VENTANAS, Acumulado> ventanas;
+    BocetoCuantiles<T> boceto;  ///< Percentiles aproximados de todas las mediciones
+    
+    /**
+     * @brief Constructor
+     * @param tipoSensor Categoria del sensor concreto
+     * @param identificador Codigo unico del sensor
+     * @param limite Limite inicial del nivel reciente
+     */
+    SensorEscalonado(TipoSensor tipoSensor, const char* identificador, int limite)
+        : SensorBase(tipoSensor, identificador), picoBytes(0), limiteReciente(limite) {
+        registroMediciones = new ListaSensor<T>();
+        MarcaTiempo duraciones[CANTIDAD_VENTANAS];
+        for (int i = 0; i < CANTIDAD_VENTANAS; i++) {
+            duraciones[i] = duracionVentana(i);
+        }
+        ventanas = VentanasDeslizantes<T, CANTIDAD_VENTANAS, Acumulado>(duraciones);
+        if (Bitacora::activa()) {
+            std::cout << Derivado::etiquetaBitacora() << " Inicializado: " << getNombre() << std::endl;
+        }
+    }
+    
+    /**
+     * @brief Constructor de traslado
+     * @param otro Sensor cuyo historial se traslada
+     * 
+     * Permite guardar sensores por valor en contenedores contiguos. El
+     * sensor de origen queda sin historial y solo admite ser destruido.
+     */
+    SensorEscalonado(SensorEscalonado&& otro) noexcept
+        : SensorBase(otro), registroMediciones(otro.registroMediciones),
+          marcasRecientes(std::move(otro.marcasRecientes)),
+          archivoComprimido(std::move(otro.archivoComprimido)),
+          picoBytes(otro.picoBytes), limiteReciente(otro.limiteReciente),
+          ventanas(std::move(otro.ventanas)), boceto(std::move(otro.boceto)) {
+        otro.registroMediciones = nullptr;
+    }
+    
+public:
+    SensorEscalonado(const SensorEscalonado&) = delete;
+    SensorEscalonado& operator=(const SensorEscalonado&) = delete;
+    
+    /**
+     * @brief Destructor
+     * 
+     * Libera la memoria ocupada por el historial de mediciones.
+     */
+    ~SensorEscalonado() override {
+        if (registroMediciones == nullptr) {
+            return;
+        }
+        if (Bitacora::activa()) {
+            std::cout << "[Finalizacion " << getNombre() << "]" << std::endl;
+        }
+        delete registroMediciones;
+    }
+    
+    /**
+     * @brief Incorpora una nueva medicion al registro
+     * @param medida Valor medido
+     * 
+     * Agrega la lectura a la lista de mediciones, con la marca de tiempo
+     * del momento de llegada.
+     */
+    void agregarLectura(T medida) {
+        agregarLectura(medida, RelojMonotonico::ahora());
+    }
+    
+    /**
+     * @brief Incorpora una medicion con marca de tiempo explicita
+     * @param medida Valor medido
+     * @param marca Instante de la medicion segun RelojMonotonico
+     * 
+     * Una marca anterior a la ultima registrada se ajusta a esta, de modo
+     * que el historial quede ordenado por tiempo. La medicion actualiza las
+     * ventanas moviles y el boceto de percentiles y, si la lista alcanza el
+     * limite del nivel reciente, se compacta.
+     */
+    void agregarLectura(T medida, MarcaTiempo marca) {
+        const MarcaTiempo ultima = getUltimaMarca();
+        if (marca < ultima) {
+            marca = ultima;
+        }
+        INSTRUMENTO_MARCA(marcaEtapa);
+        ventanas.agregar(marca, medida);
+        boceto.agregar(medida);
+        INSTRUMENTO_ETAPA(ETAPA_AGREGACION, marcaEtapa);
+        registroMediciones->insertarAlFinal(medida);
+        marcasRecientes.push_back(marca);
+        if (Bitacora::activa()) {
+            static_cast<const Derivado*>(this)->informarLectura(medida);
+        }
+        if (limiteReciente > 0 && registroMediciones->getTamanio() >= limiteReciente) {
+            compactarHistorial();
+        }
+        INSTRUMENTO_ETAPA(ETAPA_INSERCION, marcaEtapa);
+    }
+    
+    /**
+     * @brief Incorpora un arreglo de mediciones del mismo sensor en una operacion
+     * @param medidas Valores medidos
+     * @param marcas Instantes de las mediciones segun RelojMonotonico
+     * @param cantidad Numero de mediciones
+     * 
+     * Pensado para tramas binarias o reproducciones que entregan cientos de
+     * mediciones juntas. Las marcas se ajustan como en agregarLectura; las
+     * ventanas y el boceto reciben el arreglo completo y la lista reciente
+     * lo recibe por tramos que respetan el limite de compactacion. El
+     * estado final es el mismo que con una llamada por medicion, salvo el
+     * redondeo de la suma de las ventanas. Con la bitacora activa se emite
+     * una unica linea de resumen.
+     */
+    void agregarLecturas(const T* medidas, const MarcaTiempo* marcas, int cantidad) {
+        if (cantidad <= 0) {
+            return;
+        }
+        const bool informar = Bitacora::activa();
+        SilencioBitacora silencio;
+        std::vector<MarcaTiempo> ajustadas(marcas, marcas + cantidad);
+        MarcaTiempo ultima = getUltimaMarca();
+        for (int i = 0; i < cantidad; i++) {
+            ultima = std::max(ultima, ajustadas[static_cast<std::size_t>(i)]);
+            ajustadas[static_cast<std::size_t>(i)] = ultima;
+        }
+        ventanas.agregarBloque(ajustadas.data(), medidas, cantidad);
+        boceto.agregarBloque(medidas, static_cast<std::size_t>(cantidad));
+        
+        int almacenadas = 0;
+        while (almacenadas < cantidad) {
+            int tramo = cantidad - almacenadas;
+            if (limiteReciente > 0) {
+                tramo = std::max(1, std::min(tramo, limiteReciente - registroMediciones->getTamanio()));
+            }
+            registroMediciones->insertarBloque(medidas + almacenadas, tramo);
+            marcasRecientes.insert(marcasRecientes.end(), ajustadas.begin() + almacenadas,
+                                   ajustadas.begin() + almacenadas + tramo);
+            almacenadas += tramo;
+            if (limiteReciente > 0 && registroMediciones->getTamanio() >= limiteReciente) {
+                compactarHistorial();
+            }
+        }
+        
+        if (informar) {
+            double suma = 0.0;
+            T minimo = medidas[0];
+            T maximo = medidas[0];
+            acumularBloque(medidas, static_cast<std::size_t>(cantidad), suma, minimo, maximo);
+            std::cout << "[Datos] " << cantidad << " valores " << Derivado::descripcionValores()
+                      << " almacenados en " << getNombre() << std::fixed << std::setprecision(1)
+                      << " (minimo " << minimo << ", maximo " << maximo << ", media " << suma / cantidad << ")"
+                      << std::endl;
+        }
+    }
+    
+    /**
+     * @brief Traslada las mediciones recientes al historial comprimido
+     * 
+     * La clase derivada codifica la lista en el Archivo; aqui se liberan
+     * los nodos y se emite un unico mensaje de resumen.
+     */
+    void compactarHistorial() {
+        if (registroMediciones->estaVacia()) {
+            return;
+        }
+        getUsoMemoria();
+        const int trasladadas = registroMediciones->getTamanio();
+        static_cast<Derivado*>(this)->archivarRecientes();
+        {
+            SilencioBitacora silencio;
+            registroMediciones->vaciar();
+        }
+        marcasRecientes.clear();
+        
+        if (Bitacora::activa()) {
+            std::cout << Derivado::etiquetaBitacora() << " " << trasladadas << " mediciones compactadas en "
+                      << getNombre() << " (" << archivoComprimido.bytesOcupados() << " bytes comprimidos)"
+                      << std::endl;
+        }
+    }
+    
+    /**
+     * @brief Agregados de las mediciones en [desde, hasta)
+     * @param desde Marca de tiempo inicial (incluida)
+     * @param hasta Marca de tiempo final (excluida)
+     * @return Cantidad, minimo, maximo y suma de las mediciones del intervalo
+     * 
+     * El historial comprimido se consulta por bloques; en el nivel reciente
+     * la primera medicion del intervalo se ubica por busqueda binaria sobre
+     * las marcas.
+     */
+    ResumenRango consultarRango(MarcaTiempo desde, MarcaTiempo hasta) const override {
+        ResumenRango resumen;
+        if (desde >= hasta) {
+            return resumen;
+        }
+        archivoComprimido.acumularRango(desde, hasta, resumen);
+        
+        const std::size_t primera = static_cast<std::size_t>(
+            std::lower_bound(marcasRecientes.begin(), marcasRecientes.end(), desde) - marcasRecientes.begin());
+        if (primera == marcasRecientes.size() || marcasRecientes[primera] >= hasta) {
+            return resumen;
+        }
+        typename ListaSensor<T>::const_iterator actual = registroMediciones->cbegin();
+        std::advance(actual, primera);
+        for (std::size_t i = primera; i < marcasRecientes.size() && marcasRecientes[i] < hasta; i++, ++actual) {
+            resumen.incorporar(*actual);
+        }
+        return resumen;
+    }
+    
+    /**
+     * @brief Agregados de una ventana movil
+     * @param indice Posicion de la ventana (0 a CANTIDAD_VENTANAS - 1)
+     * @param ahora Instante en que termina la ventana
+     * @return Cantidad, minimo, maximo y suma de las mediciones de la ventana
+     */
+    ResumenRango consultarVentana(int indice, MarcaTiempo ahora) override {
+        if (indice < 0 || indice >= CANTIDAD_VENTANAS) {
+            return ResumenRango();
+        }
+        ventanas.expirar(indice, ahora);
+        return ventanas.resumir(indice);
+    }
+    
+    /**
+     * @brief Estima un percentil de todas las mediciones registradas
+     * @param q Fraccion acumulada buscada (0.5 mediana, 0.99 percentil 99)
+     * @return Valor estimado por el boceto, o 0 si no hay mediciones
+     */
+    double estimarCuantil(double q) const override {
+        return boceto.cuantil(q);
+    }
+    
+    /**
+     * @brief Cambia la precision del boceto de percentiles
+     * @param precision Parametro k del boceto (mayor k, menor error y mas memoria)
+     */
+    void setPrecisionCuantiles(int precision) {
+        boceto.setPrecision(precision);
+    }
+    
+    /**
+     * @brief Accede al boceto de percentiles
+     * @return Referencia constante, apta para combinar bocetos de varios sensores
+     */
+    const BocetoCuantiles<T>& getBoceto() const {
+        return boceto;
+    }
+    
+    /**
+     * @brief Marca de tiempo de la medicion mas reciente
+     * @return Ultima marca registrada, o la menor marca representable si no hay mediciones
+     */
+    MarcaTiempo getUltimaMarca() const {
+        return marcasRecientes.empty() ? archivoComprimido.getUltimaMarca() : marcasRecientes.back();
+    }
+    
+    /**
+     * @brief Escribe el historial en formato binario
+     * @param salida Flujo binario de destino
+     * @return true si la escritura fue exitosa, false en caso contrario
+     * 
+     * Escribe el historial comprimido, el boceto de percentiles, las
+     * mediciones recientes y sus marcas.
+     */
+    bool guardarEstado(std::ostream& salida) const override {
+        archivoComprimido.guardar(salida);
+        boceto.guardar(salida);
+        escribirVectorBinario(salida, marcasRecientes);
+        return registroMediciones->guardarBinario(salida);
+    }
+    
+    /**
+     * @brief Agrega al historial las mediciones de un flujo binario
+     * @param entrada Flujo binario de origen
+     * @return true si la lectura fue exitosa, false en caso contrario
+     */
+    bool cargarEstado(std::istream& entrada) override {
+        if (!archivoComprimido.cargar(entrada) || !boceto.cargar(entrada) ||
+            !leerVectorBinario(entrada, marcasRecientes)) {
+            return false;
+        }
+        return registroMediciones->cargarBinario(entrada) &&
+               static_cast<std::size_t>(registroMediciones->getTamanio()) == marcasRecientes.size();
+    }
+    
+    /**
+     * @brief Traslada las marcas del historial comprimido y del reciente
+     * @param desplazamiento Milisegundos a sumar a cada marca
+     */
+    void desplazarMarcas(MarcaTiempo desplazamiento) override {
+        archivoComprimido.desplazarMarcas(desplazamiento);
+        for (std::size_t i = 0; i < marcasRecientes.size(); i++) {
+            marcasRecientes[i] += desplazamiento;
+        }
+    }
+    
+    /**
+     * @brief Cantidad total de mediciones, recientes y compactadas
+     * @return Numero de mediciones registradas por el sensor
+     */
+    long long getCantidadMediciones() const override {
+        return archivoComprimido.getCantidad() + registroMediciones->getTamanio();
+    }
+    
+    /**
+     * @brief Memoria del sensor, desglosada por nivel
+     * @return Bytes actuales y maximos, y nodos de la lista reciente
+     * 
+     * El maximo se actualiza en cada consulta y antes de cada compactacion,
+     * que es cuando el nivel reciente esta lleno.
+     */
+    UsoMemoria getUsoMemoria() const override {
+        UsoMemoria uso;
+        uso.bytesReciente = registroMediciones->bytesOcupados() + marcasRecientes.capacity() * sizeof(MarcaTiempo);
+        uso.bytesArchivo = archivoComprimido.bytesOcupados() - sizeof(archivoComprimido);
+        uso.bytesAgregados = boceto.bytesOcupados() - sizeof(boceto);
+        uso.bytesAgregados += ventanas.bytesOcupados();
+        uso.bytes = sizeof(Derivado) + uso.bytesReciente + uso.bytesArchivo + uso.bytesAgregados;
+        if (uso.bytes > picoBytes) {
+            picoBytes = uso.bytes;
+        }
+        uso.bytesPico = picoBytes;
+        uso.nodosVivos = registroMediciones->getTamanio();
+        uso.nodosPico = registroMediciones->getPicoElementos();
+        return uso;
+    }
+    
+    /**
+     * @brief Configura el limite del nivel reciente
+     * @param limite Mediciones en la lista antes de compactar (0 desactiva la compactacion)
+     */
+    void setLimiteReciente(int limite) {
+        limiteReciente = limite < 0 ? 0 : limite;
+    }
+    
+    /**
+     * @brief Accede al historial comprimido
+     * @return Referencia constante a las mediciones compactadas
+     */
+    const Archivo& getArchivo() const {
+        return archivoComprimido;
+    }
+    
+    /**
+     * @brief Accede al registro de mediciones
+     * @return Puntero a la lista de mediciones recientes
+     * 
+     * Permite acceso directo al historial para operaciones avanzadas.
+     * Las mediciones ya compactadas se consultan con getArchivo().
+     */
+    ListaSensor<T>* getHistorial() {
+        return registroMediciones;
+    }
+};
+
+#endif // SENSORESCALONADO_H
@@ -9,10 +9,14 @@
 #ifndef SENSORPRESION_H
 #define SENSORPRESION_H
 
-#include "SensorBase.h"
-#include "ListaSensor.h"
+#include "SensorEscalonado.h"
+#include "HistorialEmpaquetado.h"
+#include <cmath>
+#include <numeric>
 #include <iostream>
 #include <iomanip>
+#include <utility>
+#include <vector>
 
 /**
  * @class SensorPresion
@@ -21,67 +25,94 @@
  * Hereda de SensorBase e implementa la funcionalidad especifica
  * para sensores de presion. Almacena mediciones de tipo entero
  * y calcula la media aritmetica de los valores registrados.
+ * 
+ * Las mediciones recientes se guardan en una ListaSensor<int>; cada vez
+ * que la lista completa un bloque de 128 valores se compacta, junto con
+ * sus marcas de tiempo, en un HistorialEmpaquetado (SensorEscalonado).
  */
-class SensorPresion : public SensorBase {
+class SensorPresion final : public SensorEscalonado<SensorPresion, int, HistorialEmpaquetado, long long> {
 private:
-    ListaSensor<int>* registroMediciones;  ///< Coleccion de mediciones de presion
+    typedef SensorEscalonado<SensorPresion, int, HistorialEmpaquetado, long long> Escalonado;
+    friend Escalonado;
+    
+    static const char* etiquetaBitacora() { return "[Dispositivo Barometrico]"; }
+    static const char* descripcionValores() { return "enteros"; }
+    
+    void informarLectura(int medida) const {
+        std::cout << "[Dato] Valor entero " << medida << " almacenado" << std::endl;
+    }
+    
+    /**
+     * @brief Codifica la lista en bloques de 128 valores del HistorialEmpaquetado
+     */
+    void archivarRecientes() {
+        std::size_t indice = 0;
+        int32_t bloque[HistorialEmpaquetado::TAMANIO_BLOQUE];
+        int ocupados = 0;
+        HistorialEmpaquetado& archivo = archivoComprimido;
+        const std::vector<MarcaTiempo>& marcas = marcasRecientes;
+        registroMediciones->iterar([&archivo, &marcas, &bloque, &ocupados, &indice](int medida) {
+            bloque[ocupados++] = medida;
+            indice++;
+            if (ocupados == HistorialEmpaquetado::TAMANIO_BLOQUE) {
+                archivo.agregarBloque(bloque, &marcas[indice - ocupados], ocupados);
+                ocupados = 0;
+            }
+        });
+        if (ocupados > 0) {
+            archivoComprimido.agregarBloque(bloque, &marcasRecientes[indice - ocupados], ocupados);
+        }
+    }
     
 public:
+    /// Limite inicial del nivel reciente: un bloque completo del historial empaquetado
+    static const int LIMITE_RECIENTE_PREDETERMINADO = HistorialEmpaquetado::TAMANIO_BLOQUE;
+    
     /**
      * @brief Constructor parametrizado
      * @param identificador Codigo unico del sensor (por defecto "PRES-000")
      * 
      * Inicializa el sensor barometrico y crea una lista para almacenar mediciones.
      */
-    SensorPresion(const char* identificador = "PRES-000") : SensorBase(identificador) {
-        registroMediciones = new ListaSensor<int>();
-        std::cout << "[Dispositivo Barometrico] Inicializado: " << nombre << std::endl;
-    }
+    SensorPresion(const char* identificador = "PRES-000")
+        : Escalonado(SENSOR_PRESION, identificador, LIMITE_RECIENTE_PREDETERMINADO) {}
     
     /**
-     * @brief Destructor especializado
-     * 
-     * Libera la memoria ocupada por el historial de mediciones.
+     * @brief Constructor de traslado
+     * @param otro Sensor cuyo historial se traslada
      */
-    ~SensorPresion() override {
-        std::cout << "[Finalizacion " << nombre << "]" << std::endl;
-        delete registroMediciones;
-    }
+    SensorPresion(SensorPresion&& otro) noexcept : Escalonado(std::move(otro)) {}
     
     /**
-     * @brief Incorpora una nueva medicion al registro
-     * @param medida Valor de presion en Pascales
-     * 
-     * Agrega una nueva lectura de presion a la lista de mediciones.
+     * @brief Ingesta generica desde la clase base
+     * @param valor Medicion (se redondea al Pascal mas cercano)
+     * @param marca Instante de la medicion segun RelojMonotonico
      */
-    void agregarLectura(int medida) {
-        registroMediciones->insertarAlFinal(medida);
-        std::cout << "[Dato] Valor entero " << medida << " almacenado" << std::endl;
+    void agregarLecturaGenerica(double valor, MarcaTiempo marca) override {
+        agregarLectura(static_cast<int>(std::lround(valor)), marca);
     }
     
     /**
      * @brief Implementacion del metodo abstracto de procesamiento
      * 
      * Calcula y muestra la media aritmetica de las presiones registradas.
-     * Si no hay mediciones disponibles, informa al usuario.
+     * La parte compactada aporta la suma guardada en la cabecera de cada
+     * bloque, sin desempaquetarlo. Si no hay mediciones disponibles,
+     * informa al usuario.
      */
     void procesarLectura() override {
-        if (registroMediciones->estaVacia()) {
+        if (getCantidadMediciones() == 0) {
             std::cout << "[Dispositivo Barometrico] Registro vacio, sin datos para analizar" << std::endl;
             return;
         }
         
         // Calcular media aritmetica de las mediciones
-        int acumulador = 0;
-        int cantidadDatos = 0;
-        
-        registroMediciones->iterar([&acumulador, &cantidadDatos](int medida) {
-            acumulador += medida;
-            cantidadDatos++;
-        });
+        const long long acumulador = std::accumulate(registroMediciones->cbegin(), registroMediciones->cend(),
+                                                     archivoComprimido.sumar());
+        const long long cantidadDatos = getCantidadMediciones();
         
         double mediaCalculada = static_cast<double>(acumulador) / cantidadDatos;
-        std::cout << "[Dispositivo Barometrico] Media aritmetica: " 
+        std::cout << "[Dispositivo Barometrico] Media aritmetica: "
                   << std::fixed << std::setprecision(2) << mediaCalculada << std::endl;
     }
     
@@ -95,11 +126,14 @@ public:
     void imprimirInfo() const override {
         std::cout << "\n>>> Detalles del Dispositivo <<<" << std::endl;
         std::cout << "Categoria: Sensor Barometrico" << std::endl;
-        std::cout << "Identificador: " << nombre << std::endl;
-        std::cout << "Mediciones registradas: " << registroMediciones->getTamanio() << std::endl;
+        std::cout << "Identificador: " << getNombre() << std::endl;
+        std::cout << "Mediciones registradas: " << getCantidadMediciones() << std::endl;
         
-        if (!registroMediciones->estaVacia()) {
+        if (getCantidadMediciones() > 0) {
             std::cout << "Conjunto de datos: ";
+            archivoComprimido.iterar([](int medida) {
+                std::cout << medida << " Pascales ";
+            });
             registroMediciones->iterar([](int medida) {
                 std::cout << medida << " Pascales ";
             });
@@ -107,16 +141,6 @@ public:
         }
         std::cout << "================================\n" << std::endl;
     }
-    
-    /**
-     * @brief Accede al registro de mediciones
-     * @return Puntero a la lista de mediciones de presion
-     * 
-     * Permite acceso directo al historial para operaciones avanzadas.
-     */
-    ListaSensor<int>* getHistorial() {
-        return registroMediciones;
-    }
 };
 
 #endif // SENSORPRESION_H
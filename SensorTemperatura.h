@@ -9,10 +9,13 @@
 #ifndef SENSORTEMPERATURA_H
 #define SENSORTEMPERATURA_H
 
-#include "SensorBase.h"
-#include "ListaSensor.h"
-#include <iostream>
+#include "SensorEscalonado.h"
+#include "HistorialGorilla.h"
+#include <algorithm>
 #include <iomanip>
+#include <iostream>
+#include <utility>
+#include <vector>
 
 /**
  * @class SensorTemperatura
@@ -21,66 +24,92 @@
  * Hereda de SensorBase e implementa la funcionalidad especifica
  * para sensores de temperatura. Almacena mediciones de tipo float
  * y calcula el valor minimo registrado.
+ * 
+ * El historial tiene dos niveles (SensorEscalonado): las mediciones
+ * recientes se guardan en una ListaSensor<float> y, al alcanzar el limite
+ * configurado, se compactan en un HistorialGorilla junto con sus marcas
+ * de tiempo.
  */
-class SensorTemperatura : public SensorBase {
+class SensorTemperatura final : public SensorEscalonado<SensorTemperatura, float, HistorialGorilla> {
 private:
-    ListaSensor<float>* registroMediciones;  ///< Coleccion de mediciones termicas
+    typedef SensorEscalonado<SensorTemperatura, float, HistorialGorilla> Escalonado;
+    friend Escalonado;
+    
+    static const char* etiquetaBitacora() { return "[Dispositivo Termico]"; }
+    static const char* descripcionValores() { return "decimales"; }
+    
+    void informarLectura(float medida) const {
+        std::cout << "[Dato] Valor decimal " << std::fixed << std::setprecision(1)
+                  << medida << " almacenado" << std::endl;
+    }
+    
+    /**
+     * @brief Codifica cada medicion de la lista en el HistorialGorilla
+     */
+    void archivarRecientes() {
+        std::size_t indice = 0;
+        HistorialGorilla& archivo = archivoComprimido;
+        const std::vector<MarcaTiempo>& marcas = marcasRecientes;
+        registroMediciones->iterar([&archivo, &marcas, &indice](float medida) {
+            archivo.agregar(marcas[indice], medida);
+            indice++;
+        });
+    }
     
 public:
+    static const int LIMITE_RECIENTE_PREDETERMINADO = 256;  ///< Limite inicial del nivel reciente
+    
     /**
      * @brief Constructor parametrizado
      * @param identificador Codigo unico del sensor (por defecto "TERM-000")
      * 
      * Inicializa el sensor termico y crea una lista para almacenar mediciones.
      */
-    SensorTemperatura(const char* identificador = "TERM-000") : SensorBase(identificador) {
-        registroMediciones = new ListaSensor<float>();
-        std::cout << "[Dispositivo Termico] Inicializado: " << nombre << std::endl;
-    }
+    SensorTemperatura(const char* identificador = "TERM-000")
+        : Escalonado(SENSOR_TEMPERATURA, identificador, LIMITE_RECIENTE_PREDETERMINADO) {}
     
     /**
-     * @brief Destructor especializado
-     * 
-     * Libera la memoria ocupada por el historial de mediciones.
+     * @brief Constructor de traslado
+     * @param otro Sensor cuyo historial se traslada
      */
-    ~SensorTemperatura() override {
-        std::cout << "[Finalizacion " << nombre << "]" << std::endl;
-        delete registroMediciones;
-    }
+    SensorTemperatura(SensorTemperatura&& otro) noexcept : Escalonado(std::move(otro)) {}
     
     /**
-     * @brief Incorpora una nueva medicion al registro
-     * @param medida Valor de temperatura en grados Celsius
-     * 
-     * Agrega una nueva lectura de temperatura a la lista de mediciones.
+     * @brief Ingesta generica desde la clase base
+     * @param valor Medicion
+     * @param marca Instante de la medicion segun RelojMonotonico
      */
-    void agregarLectura(float medida) {
-        registroMediciones->insertarAlFinal(medida);
-        std::cout << "[Dato] Valor decimal " << std::fixed << std::setprecision(1) 
-                  << medida << " almacenado" << std::endl;
+    void agregarLecturaGenerica(double valor, MarcaTiempo marca) override {
+        agregarLectura(static_cast<float>(valor), marca);
     }
     
     /**
      * @brief Implementacion del metodo abstracto de procesamiento
      * 
      * Calcula y muestra el valor minimo de temperatura registrado.
+     * El historial comprimido aporta el minimo de sus cabeceras de bloque,
+     * sin decodificarse; solo el nivel reciente se recorre.
      * Si no hay mediciones disponibles, informa al usuario.
      */
     void procesarLectura() override {
-        if (registroMediciones->estaVacia()) {
+        if (getCantidadMediciones() == 0) {
             std::cout << "[Dispositivo Termico] Registro vacio, sin datos para analizar" << std::endl;
             return;
         }
         
         // Determinar valor inferior del conjunto
         float valorMinimo = 999999.0f;
-        registroMediciones->iterar([&valorMinimo](float medida) {
-            if (medida < valorMinimo) {
-                valorMinimo = medida;
-            }
-        });
+        const ResumenRango archivo = archivoComprimido.resumir();
+        if (archivo.cantidad > 0 && archivo.minimo < valorMinimo) {
+            valorMinimo = static_cast<float>(archivo.minimo);
+        }
+        ListaSensor<float>::const_iterator minimoReciente =
+            std::min_element(registroMediciones->cbegin(), registroMediciones->cend());
+        if (minimoReciente != registroMediciones->cend() && *minimoReciente < valorMinimo) {
+            valorMinimo = *minimoReciente;
+        }
         
-        std::cout << "[Dispositivo Termico] Valor minimo detectado: " 
+        std::cout << "[Dispositivo Termico] Valor minimo detectado: "
                   << std::fixed << std::setprecision(1) << valorMinimo << std::endl;
     }
     
@@ -94,11 +123,14 @@ public:
     void imprimirInfo() const override {
         std::cout << "\n>>> Detalles del Dispositivo <<<" << std::endl;
         std::cout << "Categoria: Sensor Termico" << std::endl;
-        std::cout << "Identificador: " << nombre << std::endl;
-        std::cout << "Mediciones registradas: " << registroMediciones->getTamanio() << std::endl;
+        std::cout << "Identificador: " << getNombre() << std::endl;
+        std::cout << "Mediciones registradas: " << getCantidadMediciones() << std::endl;
         
-        if (!registroMediciones->estaVacia()) {
+        if (getCantidadMediciones() > 0) {
             std::cout << "Conjunto de datos: ";
+            archivoComprimido.iterar([](MarcaTiempo, float medida) {
+                std::cout << std::fixed << std::setprecision(1) << medida << " grados ";
+            });
             registroMediciones->iterar([](float medida) {
                 std::cout << std::fixed << std::setprecision(1) << medida << " grados ";
             });
@@ -106,16 +138,6 @@ public:
         }
         std::cout << "================================\n" << std::endl;
     }
-    
-    /**
-     * @brief Accede al registro de mediciones
-     * @return Puntero a la lista de mediciones termicas
-     * 
-     * Permite acceso directo al historial para operaciones avanzadas.
-     */
-    ListaSensor<float>* getHistorial() {
-        return registroMediciones;
-    }
 };
 
 #endif // SENSORTEMPERATURA_H
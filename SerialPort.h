@@ -9,6 +9,7 @@
 #ifndef SERIALPORT_H
 #define SERIALPORT_H
 
+#include "Instrumentacion.h"
 #include <string>
 #include <fstream>
 #include <iostream>
@@ -128,6 +129,7 @@ public:
             bytesCapturados = read(descriptorArchivo, &caracter, 1);
             
             if (bytesCapturados < 0) {
+                INSTRUMENTO_CONTAR(CONTADOR_ERRORES_LECTURA);
                 std::cerr << "[ERROR] Fallo en lectura de puerto serial" << std::endl;
                 return false;
             }
@@ -141,12 +143,17 @@ public:
             // Detectar terminador de linea
             if (caracter == '\n' || caracter == '\r') {
                 if (!secuencia.empty()) {
+                    INSTRUMENTO_CONTAR(CONTADOR_LINEAS);
+                    INSTRUMENTO_TERMINAR_LECTURA();
                     return true;
                 }
                 continue;
             }
             
             // Concatenar caracter a la secuencia
+            if (secuencia.empty()) {
+                INSTRUMENTO_INICIAR_LINEA();
+            }
             secuencia += caracter;
         }
     }
@@ -0,0 +1,450 @@
+/**
+ * @file ServidorMetricas.h
+ * @brief Publicacion de metricas del sistema en formato de texto de Prometheus
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef SERVIDORMETRICAS_H
+#define SERVIDORMETRICAS_H
+
+#include "ColaSPSC.h"
+#include "ColeccionSensores.h"
+#include "IngestaSerial.h"
+#include "Instrumentacion.h"
+#include "MotorAlertas.h"
+#include "RelojMonotonico.h"
+#include "TablaIdentificadores.h"
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/**
+ * @struct MetricaSensor
+ * @brief Estado publicado de un sensor
+ */
+struct MetricaSensor {
+    IdSensor id;            ///< Nombre internado del sensor
+    TipoSensor tipo;        ///< Tipo concreto
+    long long mediciones;   ///< Mediciones registradas
+    std::size_t bytes;      ///< Memoria actual del sensor
+    std::size_t bytesPico;  ///< Mayor memoria observada
+};
+
+/**
+ * @class PublicacionMetricas
+ * @brief Copia del estado de la ingesta que el servidor puede leer sin cerrojos compartidos
+ * 
+ * El registro de sensores no admite accesos concurrentes, de modo que es el
+ * propio ciclo de captura quien copia su estado, una vez por periodo. Los
+ * contadores se publican en variables atomicas; la lista por sensor se
+ * prepara aparte y se intercambia con try_lock: si el servidor la esta
+ * leyendo, la captura no espera y reintenta con la linea siguiente.
+ */
+class PublicacionMetricas {
+private:
+    std::atomic<long long> lineas;       ///< Lineas recibidas
+    std::atomic<long long> mediciones;   ///< Mediciones aceptadas
+    std::atomic<long long> rechazos;     ///< Lineas con formato invalido
+    std::atomic<long long> sensores;     ///< Sensores en el registro
+    std::atomic<MarcaTiempo> instante;   ///< Momento de la ultima publicacion completa
+    
+    std::mutex cerrojo;                         ///< Protege publicados
+    std::vector<MetricaSensor> publicados;      ///< Estado por sensor visible para el servidor
+    std::vector<MetricaSensor> borrador;        ///< Estado en preparacion (solo hilo de captura)
+    bool borradorListo;                         ///< borrador aguarda el intercambio
+    MarcaTiempo periodo;                        ///< Intervalo minimo entre publicaciones
+    MarcaTiempo proxima;                        ///< Instante de la siguiente publicacion
+    
+public:
+    /**
+     * @brief Constructor
+     * @param intervalo Milisegundos entre publicaciones (predeterminado 1000)
+     */
+    explicit PublicacionMetricas(MarcaTiempo intervalo = 1000)
+        : lineas(0), mediciones(0), rechazos(0), sensores(0), instante(0),
+          borradorListo(false), periodo(intervalo), proxima(0) {}
+    
+    PublicacionMetricas(const PublicacionMetricas&) = delete;
+    PublicacionMetricas& operator=(const PublicacionMetricas&) = delete;
+    
+    /**
+     * @brief Publica el estado si vencio el periodo (solo desde el hilo de captura)
+     * @param ingesta Contadores de la ruta de captura
+     * @param registro Coleccion de sensores
+     * @param ahora Instante actual segun RelojMonotonico
+     * @return true si el estado por sensor quedo visible para el servidor
+     */
+    bool publicarSiCorresponde(const IngestaSerial& ingesta, const ColeccionSensores* registro, MarcaTiempo ahora) {
+        if (!borradorListo) {
+            if (ahora < proxima) {
+                return false;
+            }
+            borrador.clear();
+            registro->iterar([this](SensorBase* dispositivo) {
+                MetricaSensor metrica;
+                metrica.id = dispositivo->getId();
+                metrica.tipo = dispositivo->getTipo();
+                metrica.mediciones = dispositivo->getCantidadMediciones();
+                const UsoMemoria uso = dispositivo->getUsoMemoria();
+                metrica.bytes = uso.bytes;
+                metrica.bytesPico = uso.bytesPico;
+                borrador.push_back(metrica);
+            });
+            lineas.store(ingesta.getContadorLineas(), std::memory_order_relaxed);
+            mediciones.store(ingesta.getContadorLecturas(), std::memory_order_relaxed);
+            rechazos.store(ingesta.getContadorRechazos(), std::memory_order_relaxed);
+            sensores.store(registro->getTamanio(), std::memory_order_relaxed);
+            borradorListo = true;
+            proxima = ahora + periodo;
+        }
+        
+        std::unique_lock<std::mutex> guardia(cerrojo, std::try_to_lock);
+        if (!guardia.owns_lock()) {
+            return false;
+        }
+        publicados.swap(borrador);
+        instante.store(ahora, std::memory_order_release);
+        borradorListo = false;
+        return true;
+    }
+    
+    /**
+     * @brief Escribe el estado publicado en formato de texto de Prometheus
+     * @param salida Flujo de destino
+     * @param ahora Instante actual segun RelojMonotonico
+     */
+    void escribir(std::ostream& salida, MarcaTiempo ahora) {
+        salida << "# HELP sensores_lineas_total Lineas recibidas por el puerto serial\n"
+               << "# TYPE sensores_lineas_total counter\n"
+               << "sensores_lineas_total " << lineas.load(std::memory_order_relaxed) << "\n"
+               << "# HELP sensores_mediciones_total Mediciones aceptadas por la ingesta\n"
+               << "# TYPE sensores_mediciones_total counter\n"
+               << "sensores_mediciones_total " << mediciones.load(std::memory_order_relaxed) << "\n"
+               << "# HELP sensores_lineas_rechazadas_total Lineas descartadas por formato invalido\n"
+               << "# TYPE sensores_lineas_rechazadas_total counter\n"
+               << "sensores_lineas_rechazadas_total " << rechazos.load(std::memory_order_relaxed) << "\n"
+               << "# HELP sensores_registrados Sensores en el registro\n"
+               << "# TYPE sensores_registrados gauge\n"
+               << "sensores_registrados " << sensores.load(std::memory_order_relaxed) << "\n";
+        
+        const MarcaTiempo ultima = instante.load(std::memory_order_acquire);
+        if (ultima != 0) {
+            salida << "# HELP sensores_publicacion_antiguedad_segundos Tiempo desde la ultima copia del estado\n"
+                   << "# TYPE sensores_publicacion_antiguedad_segundos gauge\n"
+                   << "sensores_publicacion_antiguedad_segundos " << (ahora - ultima) / 1000.0 << "\n";
+        }
+        
+        std::lock_guard<std::mutex> guardia(cerrojo);
+        std::ostringstream memoria;
+        std::ostringstream picos;
+        std::ostringstream cantidades;
+        for (std::size_t i = 0; i < publicados.size(); i++) {
+            const MetricaSensor& metrica = publicados[i];
+            std::string etiquetas = "{sensor=\"";
+            for (const char* c = TablaIdentificadores::global().nombre(metrica.id); *c != '\0'; c++) {
+                if (*c == '"' || *c == '\\') {
+                    etiquetas += '\\';
+                }
+                etiquetas += *c;
+            }
+            etiquetas += metrica.tipo == SENSOR_TEMPERATURA ? "\",tipo=\"temperatura\"}" : "\",tipo=\"presion\"}";
+            memoria << "sensores_memoria_bytes" << etiquetas << " " << metrica.bytes << "\n";
+            picos << "sensores_memoria_pico_bytes" << etiquetas << " " << metrica.bytesPico << "\n";
+            cantidades << "sensores_mediciones_registradas" << etiquetas << " " << metrica.mediciones << "\n";
+        }
+        salida << "# HELP sensores_memoria_bytes Memoria actual por sensor\n"
+               << "# TYPE sensores_memoria_bytes gauge\n" << memoria.str()
+               << "# HELP sensores_memoria_pico_bytes Mayor memoria observada por sensor\n"
+               << "# TYPE sensores_memoria_pico_bytes gauge\n" << picos.str()
+               << "# HELP sensores_mediciones_registradas Mediciones almacenadas por sensor\n"
+               << "# TYPE sensores_mediciones_registradas gauge\n" << cantidades.str();
+    }
+};
+
+/**
+ * @class ServidorMetricas
+ * @brief Hilo que atiende GET /metrics por TCP local o por un socket Unix
+ * 
+ * El socket de escucha es no bloqueante y se consulta con poll cada 200 ms;
+ * cada conexion se atiende por completo, con plazos de lectura y escritura
+ * de un segundo, y se cierra. El hilo solo lee contadores atomicos, la cola
+ * de alertas y el estado publicado, de modo que nunca detiene la captura.
+ * 
+ * Direcciones aceptadas por iniciar():
+ * - "9464": puerto TCP en 127.0.0.1
+ * - "127.0.0.1:9464": direccion IPv4 y puerto
+ * - "unix:/ruta/metricas.sock": socket de dominio Unix
+ */
+class ServidorMetricas {
+private:
+    static const int PLAZO_MS = 1000;           ///< Plazo de lectura y escritura por conexion
+    static const std::size_t LIMITE_PETICION = 8192;  ///< Bytes maximos de cabecera leidos
+    
+    PublicacionMetricas& publicacion;  ///< Estado copiado por el ciclo de captura
+    const ColaSPSC<Alerta>& cola;      ///< Cola de alertas cuya ocupacion se informa
+    int escucha;                       ///< Socket de escucha (-1 si no se inicio)
+    std::string rutaUnix;              ///< Ruta del socket Unix, a eliminar al detener
+    std::atomic<bool> activo;          ///< Indicador de continuidad del hilo
+    std::thread hilo;                  ///< Hilo servidor
+    
+    /**
+     * @brief Arma el cuerpo de la respuesta
+     */
+    std::string generarCuerpo() {
+        std::ostringstream cuerpo;
+        publicacion.escribir(cuerpo, RelojMonotonico::ahora());
+        cuerpo << "# HELP sensores_cola_alertas_ocupacion Alertas pendientes de despacho\n"
+               << "# TYPE sensores_cola_alertas_ocupacion gauge\n"
+               << "sensores_cola_alertas_ocupacion " << cola.getOcupacion() << "\n"
+               << "# HELP sensores_cola_alertas_capacidad Capacidad de la cola de alertas\n"
+               << "# TYPE sensores_cola_alertas_capacidad gauge\n"
+               << "sensores_cola_alertas_capacidad " << cola.getCapacidad() << "\n"
+               << "# HELP sensores_alertas_descartadas_total Alertas perdidas por cola llena\n"
+               << "# TYPE sensores_alertas_descartadas_total counter\n"
+               << "sensores_alertas_descartadas_total " << cola.getDescartados() << "\n";
+#ifdef SENSORES_INSTRUMENTACION
+        Instrumentacion::global().exportarPrometheus(cuerpo);
+#endif
+        return cuerpo.str();
+    }
+    
+    /**
+     * @brief Envia un bloque completo
+     * @return false si el cliente cerro la conexion o vencio el plazo
+     */
+    static bool enviarTodo(int cliente, const std::string& datos) {
+        std::size_t enviados = 0;
+        while (enviados < datos.size()) {
+            const ssize_t escritos = send(cliente, datos.data() + enviados, datos.size() - enviados, MSG_NOSIGNAL);
+            if (escritos < 0 && errno == EINTR) {
+                continue;
+            }
+            if (escritos <= 0) {
+                return false;
+            }
+            enviados += static_cast<std::size_t>(escritos);
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Lee la peticion y responde segun su ruta
+     */
+    void atender(int cliente) {
+        timeval plazo;
+        plazo.tv_sec = PLAZO_MS / 1000;
+        plazo.tv_usec = (PLAZO_MS % 1000) * 1000;
+        setsockopt(cliente, SOL_SOCKET, SO_RCVTIMEO, &plazo, sizeof(plazo));
+        setsockopt(cliente, SOL_SOCKET, SO_SNDTIMEO, &plazo, sizeof(plazo));
+        
+        std::string peticion;
+        char bloque[1024];
+        while (peticion.find("\r\n\r\n") == std::string::npos && peticion.size() < LIMITE_PETICION) {
+            const ssize_t leidos = recv(cliente, bloque, sizeof(bloque), 0);
+            if (leidos < 0 && errno == EINTR) {
+                continue;
+            }
+            if (leidos <= 0) {
+                break;
+            }
+            peticion.append(bloque, static_cast<std::size_t>(leidos));
+        }
+        
+        const std::size_t finLinea = peticion.find("\r\n");
+        if (finLinea == std::string::npos) {
+            return;
+        }
+        std::istringstream primeraLinea(peticion.substr(0, finLinea));
+        std::string metodo;
+        std::string ruta;
+        primeraLinea >> metodo >> ruta;
+        
+        std::string estado = "200 OK";
+        std::string cuerpo;
+        if (metodo != "GET" && metodo != "HEAD") {
+            estado = "405 Method Not Allowed";
+            cuerpo = "Solo se admite GET\n";
+        } else if (ruta != "/metrics" && ruta.compare(0, 9, "/metrics?") != 0) {
+            estado = "404 Not Found";
+            cuerpo = "Ruta disponible: /metrics\n";
+        } else {
+            cuerpo = generarCuerpo();
+        }
+        
+        std::ostringstream respuesta;
+        respuesta << "HTTP/1.1 " << estado << "\r\n"
+                  << "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                  << "Content-Length: " << cuerpo.size() << "\r\n"
+                  << "Connection: close\r\n\r\n";
+        if (metodo != "HEAD") {
+            respuesta << cuerpo;
+        }
+        enviarTodo(cliente, respuesta.str());
+    }
+    
+    void ejecutar() {
+        pollfd espera;
+        espera.fd = escucha;
+        espera.events = POLLIN;
+        while (activo.load(std::memory_order_acquire)) {
+            espera.revents = 0;
+            if (poll(&espera, 1, 200) <= 0) {
+                continue;
+            }
+            const int cliente = accept(escucha, nullptr, nullptr);
+            if (cliente < 0) {
+                continue;
+            }
+            atender(cliente);
+            close(cliente);
+        }
+    }
+    
+    /**
+     * @brief Crea el socket de escucha para la direccion indicada
+     * @return Descriptor del socket, o -1 si fallo
+     */
+    int crearEscucha(const std::string& direccion) {
+        if (direccion.compare(0, 5, "unix:") == 0) {
+            const std::string ruta = direccion.substr(5);
+            sockaddr_un local;
+            std::memset(&local, 0, sizeof(local));
+            if (ruta.empty() || ruta.size() >= sizeof(local.sun_path)) {
+                std::cerr << "[ERROR] Ruta de socket Unix invalida: " << ruta << std::endl;
+                return -1;
+            }
+            local.sun_family = AF_UNIX;
+            std::memcpy(local.sun_path, ruta.c_str(), ruta.size() + 1);
+            
+            const int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (descriptor < 0) {
+                return -1;
+            }
+            unlink(ruta.c_str());
+            if (bind(descriptor, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0) {
+                std::cerr << "[ERROR] No se pudo enlazar " << ruta << ": " << std::strerror(errno) << std::endl;
+                close(descriptor);
+                return -1;
+            }
+            rutaUnix = ruta;
+            return descriptor;
+        }
+        
+        std::string host = "127.0.0.1";
+        std::string puerto = direccion;
+        const std::size_t separador = direccion.rfind(':');
+        if (separador != std::string::npos) {
+            host = direccion.substr(0, separador);
+            puerto = direccion.substr(separador + 1);
+        }
+        char* resto = nullptr;
+        const long numero = std::strtol(puerto.c_str(), &resto, 10);
+        sockaddr_in red;
+        std::memset(&red, 0, sizeof(red));
+        red.sin_family = AF_INET;
+        if (puerto.empty() || *resto != '\0' || numero < 1 || numero > 65535 ||
+            inet_pton(AF_INET, host.c_str(), &red.sin_addr) != 1) {
+            std::cerr << "[ERROR] Direccion de metricas invalida: " << direccion << std::endl;
+            return -1;
+        }
+        red.sin_port = htons(static_cast<uint16_t>(numero));
+        
+        const int descriptor = socket(AF_INET, SOCK_STREAM, 0);
+        if (descriptor < 0) {
+            return -1;
+        }
+        const int reutilizar = 1;
+        setsockopt(descriptor, SOL_SOCKET, SO_REUSEADDR, &reutilizar, sizeof(reutilizar));
+        if (bind(descriptor, reinterpret_cast<sockaddr*>(&red), sizeof(red)) != 0) {
+            std::cerr << "[ERROR] No se pudo enlazar " << direccion << ": " << std::strerror(errno) << std::endl;
+            close(descriptor);
+            return -1;
+        }
+        return descriptor;
+    }
+    
+public:
+    /**
+     * @brief Constructor
+     * @param estado Publicacion alimentada por el ciclo de captura
+     * @param alertas Cola de alertas de la captura
+     */
+    ServidorMetricas(PublicacionMetricas& estado, const ColaSPSC<Alerta>& alertas)
+        : publicacion(estado), cola(alertas), escucha(-1), activo(false) {}
+    
+    ServidorMetricas(const ServidorMetricas&) = delete;
+    ServidorMetricas& operator=(const ServidorMetricas&) = delete;
+    
+    /**
+     * @brief Abre el socket de escucha e inicia el hilo servidor
+     * @param direccion Puerto, "ip:puerto" o "unix:/ruta"
+     * @return true si el servidor quedo atendiendo
+     */
+    bool iniciar(const std::string& direccion) {
+        if (escucha >= 0) {
+            return true;
+        }
+        const int descriptor = crearEscucha(direccion);
+        if (descriptor < 0) {
+            return false;
+        }
+        fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL, 0) | O_NONBLOCK);
+        if (listen(descriptor, 8) != 0) {
+            std::cerr << "[ERROR] No se pudo escuchar en " << direccion << ": " << std::strerror(errno) << std::endl;
+            close(descriptor);
+            if (!rutaUnix.empty()) {
+                unlink(rutaUnix.c_str());
+                rutaUnix.clear();
+            }
+            return false;
+        }
+        escucha = descriptor;
+        activo.store(true, std::memory_order_release);
+        hilo = std::thread(&ServidorMetricas::ejecutar, this);
+        return true;
+    }
+    
+    /**
+     * @brief Detiene el hilo y libera el socket
+     */
+    void detener() {
+        if (escucha < 0) {
+            return;
+        }
+        activo.store(false, std::memory_order_release);
+        hilo.join();
+        close(escucha);
+        escucha = -1;
+        if (!rutaUnix.empty()) {
+            unlink(rutaUnix.c_str());
+            rutaUnix.clear();
+        }
+    }
+    
+    ~ServidorMetricas() {
+        detener();
+    }
+    
+    bool estaActivo() const { return escucha >= 0; }
+};
+
+#endif // SERVIDORMETRICAS_H
@@ -0,0 +1,143 @@
+/**
+ * @file TablaIdentificadores.h
+ * @brief Tabla de nombres de sensores internados como enteros compactos
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef TABLAIDENTIFICADORES_H
+#define TABLAIDENTIFICADORES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/// Identificador compacto de un nombre de sensor
+typedef uint32_t IdSensor;
+
+/**
+ * @class TablaIdentificadores
+ * @brief Asigna a cada nombre de sensor un entero denso la primera vez que aparece
+ * 
+ * Los sensores, las alertas y las busquedas guardan el identificador en
+ * lugar del texto: comparar dos sensores es una igualdad entera y localizar
+ * un nombre cuesta un solo calculo de dispersion.
+ * 
+ * Los nombres nunca se retiran, de modo que un identificador y el puntero
+ * devuelto por nombre() siguen siendo validos durante todo el programa.
+ * Las operaciones se protegen con un cerrojo porque el hilo de alertas
+ * traduce identificadores mientras la ingesta interna nombres nuevos.
+ */
+class TablaIdentificadores {
+public:
+    static const std::size_t LONGITUD_MAXIMA = 49;      ///< Caracteres conservados por nombre
+    static const IdSensor ID_INVALIDO = 0xFFFFFFFFu;    ///< Resultado de buscar un nombre desconocido
+    
+private:
+    mutable std::mutex cerrojo;                           ///< Protege ambas estructuras
+    std::unordered_map<std::string, IdSensor> indices;    ///< Nombre -> identificador
+    std::deque<std::string> nombres;                      ///< Identificador -> nombre (direcciones estables)
+    
+    /**
+     * @brief Recorta un nombre a la longitud admitida
+     */
+    static std::string normalizar(const char* nombre) {
+        std::string recortado(nombre);
+        const std::size_t limite = LONGITUD_MAXIMA;
+        if (recortado.size() > limite) {
+            recortado.resize(limite);
+        }
+        return recortado;
+    }
+    
+public:
+    TablaIdentificadores() {}
+    TablaIdentificadores(const TablaIdentificadores&) = delete;
+    TablaIdentificadores& operator=(const TablaIdentificadores&) = delete;
+    
+    /**
+     * @brief Tabla compartida por todos los sensores del programa
+     */
+    static TablaIdentificadores& global() {
+        static TablaIdentificadores tabla;
+        return tabla;
+    }
+    
+    /**
+     * @brief Obtiene el identificador de un nombre, registrandolo si es nuevo
+     * @param nombre Nombre del sensor (se conservan LONGITUD_MAXIMA caracteres)
+     * @return Identificador denso, asignado en orden de aparicion
+     */
+    IdSensor internar(const char* nombre) {
+        std::string clave = normalizar(nombre);
+        std::lock_guard<std::mutex> guarda(cerrojo);
+        std::unordered_map<std::string, IdSensor>::const_iterator encontrado = indices.find(clave);
+        if (encontrado != indices.end()) {
+            return encontrado->second;
+        }
+        const IdSensor nuevo = static_cast<IdSensor>(nombres.size());
+        nombres.push_back(clave);
+        indices.insert(std::make_pair(clave, nuevo));
+        return nuevo;
+    }
+    
+    /**
+     * @brief Localiza un nombre sin registrarlo
+     * @param nombre Nombre buscado
+     * @return Identificador del nombre, o ID_INVALIDO si nunca se interno
+     */
+    IdSensor buscar(const std::string& nombre) const {
+        std::lock_guard<std::mutex> guarda(cerrojo);
+        std::unordered_map<std::string, IdSensor>::const_iterator encontrado = indices.find(nombre);
+        if (encontrado == indices.end()) {
+            return ID_INVALIDO;
+        }
+        return encontrado->second;
+    }
+    
+    /**
+     * @brief Traduce un identificador a su nombre
+     * @param id Identificador devuelto por internar()
+     * @return Cadena del nombre, valida durante todo el programa; "" si el identificador no existe
+     */
+    const char* nombre(IdSensor id) const {
+        std::lock_guard<std::mutex> guarda(cerrojo);
+        if (id >= nombres.size()) {
+            return "";
+        }
+        return nombres[id].c_str();
+    }
+    
+    /**
+     * @brief Memoria estimada de la tabla
+     * @return Bytes de los nombres, en ambas estructuras, y de las cubetas del indice
+     * 
+     * Cada nombre se guarda una vez en la cola y otra como clave del
+     * indice; el texto solo ocupa memoria propia si excede el bufer
+     * interno de std::string.
+     */
+    std::size_t bytesOcupados() const {
+        std::lock_guard<std::mutex> guarda(cerrojo);
+        const std::size_t enLinea = std::string().capacity();
+        std::size_t total = sizeof(TablaIdentificadores) + indices.bucket_count() * sizeof(void*);
+        for (std::size_t i = 0; i < nombres.size(); i++) {
+            const std::size_t texto = nombres[i].capacity() > enLinea ? nombres[i].capacity() + 1 : 0;
+            total += 2 * (sizeof(std::string) + texto) + sizeof(IdSensor) + 2 * sizeof(void*);
+        }
+        return total;
+    }
+    
+    /**
+     * @brief Cantidad de nombres distintos registrados
+     */
+    std::size_t getCantidad() const {
+        std::lock_guard<std::mutex> guarda(cerrojo);
+        return nombres.size();
+    }
+};
+
+#endif // TABLAIDENTIFICADORES_H
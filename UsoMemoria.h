@@ -0,0 +1,51 @@
+/**
+ * @file UsoMemoria.h
+ * @brief Desglose de la memoria ocupada por un sensor
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef USOMEMORIA_H
+#define USOMEMORIA_H
+
+#include <cstddef>
+
+/**
+ * @struct UsoMemoria
+ * @brief Memoria actual y maxima de un sensor, separada por nivel de historial
+ * 
+ * Los bytes incluyen el objeto del sensor y todo lo que reserva: nodos de
+ * la lista reciente, marcas de tiempo, historial comprimido, ventanas
+ * moviles y boceto de percentiles. El nombre no se cuenta por sensor
+ * porque se guarda una sola vez en TablaIdentificadores.
+ */
+struct UsoMemoria {
+    std::size_t bytes;           ///< Memoria total actual
+    std::size_t bytesPico;       ///< Mayor total observado
+    std::size_t bytesReciente;   ///< Lista de mediciones recientes y sus marcas
+    std::size_t bytesArchivo;    ///< Historial comprimido
+    std::size_t bytesAgregados;  ///< Ventanas moviles y boceto de percentiles
+    long long nodosVivos;        ///< Nodos actuales de la lista reciente
+    long long nodosPico;         ///< Mayor cantidad de nodos simultaneos
+    
+    UsoMemoria()
+        : bytes(0), bytesPico(0), bytesReciente(0), bytesArchivo(0), bytesAgregados(0),
+          nodosVivos(0), nodosPico(0) {}
+    
+    /**
+     * @brief Acumula el uso de otro sensor
+     * @param otro Uso a sumar
+     */
+    void acumular(const UsoMemoria& otro) {
+        bytes += otro.bytes;
+        bytesPico += otro.bytesPico;
+        bytesReciente += otro.bytesReciente;
+        bytesArchivo += otro.bytesArchivo;
+        bytesAgregados += otro.bytesAgregados;
+        nodosVivos += otro.nodosVivos;
+        nodosPico += otro.nodosPico;
+    }
+};
+
+#endif // USOMEMORIA_H
@@ -0,0 +1,392 @@
+/**
+ * @file VentanasDeslizantes.h
+ * @brief Agregados moviles de varios intervalos sobre una sola serie de mediciones
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef VENTANASDESLIZANTES_H
+#define VENTANASDESLIZANTES_H
+
+#include "RelojMonotonico.h"
+#include "ResumenRango.h"
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @class VentanasDeslizantes
+ * @brief Minimo, maximo y media de N intervalos moviles que comparten las mediciones
+ * 
+ * La ventana i cubre el intervalo (ahora - duracion_i, ahora]. Cada medicion
+ * se guarda una sola vez, en un buffer comun que alcanza a la ventana mas
+ * larga; cada ventana es un cursor a su primera medicion vigente con su
+ * propia suma y sus propias colas monotonas. Cada medicion entra una vez y
+ * cada cursor la deja atras una vez, por lo que actualizar cuesta O(N)
+ * amortizado y consultar cuesta O(1):
+ * - La media usa una suma acumulada a la que se resta cada medicion que el
+ *   cursor deja atras.
+ * - El minimo y el maximo usan colas monotonas de posiciones del buffer:
+ *   cada una conserva solo las mediciones que aun pueden llegar a ser el
+ *   extremo de la ventana, con el extremo vigente al frente.
+ * 
+ * Los buffers son arreglos circulares que no reservan memoria hasta la
+ * primera medicion. Las marcas de tiempo deben llegar en orden no
+ * decreciente.
+ * 
+ * @tparam T Tipo de las mediciones
+ * @tparam N Cantidad de ventanas
+ * @tparam Acumulado Tipo de la suma acumulada (exacto para enteros con long long)
+ */
+template <typename T, int N, typename Acumulado = double>
+class VentanasDeslizantes {
+private:
+    static_assert(N > 0, "Se requiere al menos una ventana");
+    
+    /// Medicion con su marca de tiempo
+    struct Muestra {
+        MarcaTiempo marca;
+        T valor;
+    };
+    
+    /**
+     * @class Anillo
+     * @brief Cola doble sobre un arreglo circular que crece un 50% al llenarse
+     */
+    template <typename E>
+    class Anillo {
+    private:
+        std::vector<E> celdas;  ///< Arreglo circular; vacio hasta el primer elemento
+        std::size_t frente;     ///< Celda del primer elemento
+        std::size_t ocupadas;   ///< Elementos almacenados
+        
+        void crecer() {
+            std::vector<E> nuevas(celdas.empty() ? 16 : celdas.size() + celdas.size() / 2);
+            for (std::size_t i = 0; i < ocupadas; i++) {
+                nuevas[i] = (*this)[i];
+            }
+            celdas.swap(nuevas);
+            frente = 0;
+        }
+        
+        std::size_t celda(std::size_t indice) const {
+            const std::size_t posicion = frente + indice;
+            return posicion < celdas.size() ? posicion : posicion - celdas.size();
+        }
+        
+    public:
+        Anillo() : frente(0), ocupadas(0) {}
+        
+        Anillo(Anillo&& otro) noexcept
+            : celdas(std::move(otro.celdas)), frente(otro.frente), ocupadas(otro.ocupadas) {
+            otro.frente = 0;
+            otro.ocupadas = 0;
+        }
+        
+        Anillo& operator=(Anillo&& otro) noexcept {
+            celdas = std::move(otro.celdas);
+            frente = otro.frente;
+            ocupadas = otro.ocupadas;
+            otro.celdas.clear();
+            otro.frente = 0;
+            otro.ocupadas = 0;
+            return *this;
+        }
+        
+        E& operator[](std::size_t indice) { return celdas[celda(indice)]; }
+        const E& operator[](std::size_t indice) const { return celdas[celda(indice)]; }
+        
+        const E& primero() const { return (*this)[0]; }
+        const E& ultimo() const { return (*this)[ocupadas - 1]; }
+        
+        void agregarAlFinal(const E& elemento) {
+            if (ocupadas == celdas.size()) {
+                crecer();
+            }
+            (*this)[ocupadas] = elemento;
+            ocupadas++;
+        }
+        
+        void quitarDelFrente() {
+            frente = celda(1);
+            ocupadas--;
+        }
+        
+        void quitarDelFinal() { ocupadas--; }
+        
+        /**
+         * @brief Invierte el orden de los elementos desde una posicion hasta el final
+         */
+        void invertirDesde(std::size_t desde) {
+            for (std::size_t i = desde, j = ocupadas; i + 1 < j; i++, j--) {
+                std::swap((*this)[i], (*this)[j - 1]);
+            }
+        }
+        
+        /**
+         * @brief Elimina los elementos y devuelve la memoria
+         */
+        void vaciar() {
+            std::vector<E>().swap(celdas);
+            frente = 0;
+            ocupadas = 0;
+        }
+        
+        std::size_t getTamanio() const { return ocupadas; }
+        bool estaVacio() const { return ocupadas == 0; }
+        std::size_t bytesReservados() const { return celdas.capacity() * sizeof(E); }
+    };
+    
+    /**
+     * @struct Ventana
+     * @brief Cursor y agregados de un intervalo sobre el buffer comun
+     */
+    struct Ventana {
+        MarcaTiempo duracion;                ///< Ancho en milisegundos
+        unsigned long long inicio;           ///< Posicion absoluta de la primera medicion vigente
+        Acumulado suma;                      ///< Suma de las mediciones vigentes
+        Anillo<unsigned long long> minimos;  ///< Candidatos a minimo, valores estrictamente crecientes
+        Anillo<unsigned long long> maximos;  ///< Candidatos a maximo, valores estrictamente decrecientes
+        
+        Ventana() : duracion(60000), inicio(0), suma(0) {}
+    };
+    
+    Anillo<Muestra> muestras;        ///< Mediciones vigentes en alguna ventana, en orden de llegada
+    unsigned long long descartadas;  ///< Posicion absoluta de muestras[0]
+    Ventana ventanas[N];             ///< Intervalos moviles
+    
+    unsigned long long getTotal() const { return descartadas + muestras.getTamanio(); }
+    
+    const T& valorEn(unsigned long long posicion) const {
+        return muestras[static_cast<std::size_t>(posicion - descartadas)].valor;
+    }
+    
+    /**
+     * @brief Avanza el cursor de una ventana hasta la primera medicion posterior a ahora - duracion
+     * 
+     * Al vaciarse la ventana la suma se reinicia, lo que evita que el
+     * error de redondeo de las restas se acumule indefinidamente.
+     */
+    void expirarVentana(Ventana& ventana, MarcaTiempo ahora) {
+        const MarcaTiempo limite = ahora - ventana.duracion;
+        const unsigned long long total = getTotal();
+        while (ventana.inicio < total &&
+               muestras[static_cast<std::size_t>(ventana.inicio - descartadas)].marca <= limite) {
+            ventana.suma -= valorEn(ventana.inicio);
+            ventana.inicio++;
+        }
+        while (!ventana.minimos.estaVacio() && ventana.minimos.primero() < ventana.inicio) {
+            ventana.minimos.quitarDelFrente();
+        }
+        while (!ventana.maximos.estaVacio() && ventana.maximos.primero() < ventana.inicio) {
+            ventana.maximos.quitarDelFrente();
+        }
+        if (ventana.inicio == total) {
+            ventana.suma = 0;
+        }
+    }
+    
+    /**
+     * @brief Quita del buffer las mediciones que todos los cursores dejaron atras
+     */
+    void descartarVencidas() {
+        unsigned long long menor = ventanas[0].inicio;
+        for (int i = 1; i < N; i++) {
+            menor = std::min(menor, ventanas[i].inicio);
+        }
+        while (descartadas < menor) {
+            muestras.quitarDelFrente();
+            descartadas++;
+        }
+    }
+    
+public:
+    /**
+     * @brief Constructor con todas las ventanas de un minuto
+     */
+    VentanasDeslizantes() : descartadas(0) {}
+    
+    /**
+     * @brief Constructor
+     * @param duraciones Ancho de cada ventana en milisegundos (N valores)
+     */
+    explicit VentanasDeslizantes(const MarcaTiempo* duraciones) : descartadas(0) {
+        for (int i = 0; i < N; i++) {
+            ventanas[i].duracion = duraciones[i];
+        }
+    }
+    
+    /**
+     * @brief Incorpora una medicion y descarta las que quedan fuera de cada ventana
+     * @param marca Instante de la medicion
+     * @param valor Medicion
+     */
+    void agregar(MarcaTiempo marca, T valor) {
+        for (int i = 0; i < N; i++) {
+            expirarVentana(ventanas[i], marca);
+        }
+        const unsigned long long posicion = getTotal();
+        Muestra muestra;
+        muestra.marca = marca;
+        muestra.valor = valor;
+        muestras.agregarAlFinal(muestra);
+        
+        for (int i = 0; i < N; i++) {
+            Ventana& ventana = ventanas[i];
+            ventana.suma += valor;
+            while (!ventana.minimos.estaVacio() && !(valorEn(ventana.minimos.ultimo()) < valor)) {
+                ventana.minimos.quitarDelFinal();
+            }
+            ventana.minimos.agregarAlFinal(posicion);
+            while (!ventana.maximos.estaVacio() && !(valor < valorEn(ventana.maximos.ultimo()))) {
+                ventana.maximos.quitarDelFinal();
+            }
+            ventana.maximos.agregarAlFinal(posicion);
+        }
+        descartarVencidas();
+    }
+    
+    /**
+     * @brief Incorpora un arreglo de mediciones con marcas no decrecientes
+     * @param marcas Instantes de las mediciones
+     * @param valores Mediciones
+     * @param cantidad Numero de mediciones
+     * 
+     * Deja las ventanas como las dejaria agregar() aplicado a cada medicion:
+     * al buffer se copian solo las que siguen vigentes en la ventana mas
+     * larga respecto de la ultima marca, la suma de cada ventana se calcula
+     * con acumularBloque y sus colas monotonas reciben solo los candidatos
+     * del bloque. Un elemento previo sobrevive en la cola de minimos solo si
+     * es menor que todo el bloque; uno del bloque, solo si es menor que
+     * todos los que llegan despues.
+     */
+    void agregarBloque(const MarcaTiempo* marcas, const T* valores, int cantidad) {
+        if (cantidad <= 0) {
+            return;
+        }
+        const MarcaTiempo ultima = marcas[cantidad - 1];
+        int inicios[N];
+        int primera = cantidad;
+        for (int i = 0; i < N; i++) {
+            expirarVentana(ventanas[i], ultima);
+            const MarcaTiempo limite = ultima - ventanas[i].duracion;
+            inicios[i] = static_cast<int>(std::upper_bound(marcas, marcas + cantidad, limite) - marcas);
+            primera = std::min(primera, inicios[i]);
+        }
+        
+        const unsigned long long base = getTotal();
+        for (int j = primera; j < cantidad; j++) {
+            Muestra muestra;
+            muestra.marca = marcas[j];
+            muestra.valor = valores[j];
+            muestras.agregarAlFinal(muestra);
+        }
+        
+        for (int i = 0; i < N; i++) {
+            Ventana& ventana = ventanas[i];
+            const int inicio = inicios[i];
+            // Si alguna medicion previa sigue vigente, todo el bloque lo esta y el cursor no se mueve
+            if (ventana.inicio == base) {
+                ventana.inicio = base + static_cast<unsigned long long>(inicio - primera);
+            }
+            if (inicio == cantidad) {
+                continue;
+            }
+            
+            Acumulado sumaBloque = 0;
+            T menor = valores[inicio];
+            T mayor = valores[inicio];
+            acumularBloque(valores + inicio, static_cast<std::size_t>(cantidad - inicio), sumaBloque, menor, mayor);
+            ventana.suma += sumaBloque;
+            
+            while (!ventana.minimos.estaVacio() && !(valorEn(ventana.minimos.ultimo()) < menor)) {
+                ventana.minimos.quitarDelFinal();
+            }
+            while (!ventana.maximos.estaVacio() && !(mayor < valorEn(ventana.maximos.ultimo()))) {
+                ventana.maximos.quitarDelFinal();
+            }
+            // Candidatos del bloque: minimos y maximos estrictos de cada sufijo
+            const std::size_t baseMinimos = ventana.minimos.getTamanio();
+            const std::size_t baseMaximos = ventana.maximos.getTamanio();
+            for (int j = cantidad - 1; j >= inicio; j--) {
+                const unsigned long long posicion = base + static_cast<unsigned long long>(j - primera);
+                if (ventana.minimos.getTamanio() == baseMinimos || valores[j] < valorEn(ventana.minimos.ultimo())) {
+                    ventana.minimos.agregarAlFinal(posicion);
+                }
+                if (ventana.maximos.getTamanio() == baseMaximos || valorEn(ventana.maximos.ultimo()) < valores[j]) {
+                    ventana.maximos.agregarAlFinal(posicion);
+                }
+            }
+            ventana.minimos.invertirDesde(baseMinimos);
+            ventana.maximos.invertirDesde(baseMaximos);
+        }
+        descartarVencidas();
+    }
+    
+    /**
+     * @brief Descarta las mediciones anteriores a una ventana que termina en ahora
+     * @param indice Posicion de la ventana (0 a N - 1)
+     * @param ahora Instante de referencia
+     */
+    void expirar(int indice, MarcaTiempo ahora) {
+        expirarVentana(ventanas[indice], ahora);
+        descartarVencidas();
+    }
+    
+    /**
+     * @brief Agregados de las mediciones dentro de una ventana
+     * @param indice Posicion de la ventana (0 a N - 1)
+     * @return Cantidad, minimo, maximo y suma; vacio si la ventana no tiene mediciones
+     */
+    ResumenRango resumir(int indice) const {
+        ResumenRango resumen;
+        const Ventana& ventana = ventanas[indice];
+        const unsigned long long total = getTotal();
+        if (ventana.inicio < total) {
+            resumen.cantidad = static_cast<long long>(total - ventana.inicio);
+            resumen.minimo = valorEn(ventana.minimos.primero());
+            resumen.maximo = valorEn(ventana.maximos.primero());
+            resumen.suma = static_cast<double>(ventana.suma);
+        }
+        return resumen;
+    }
+    
+    /**
+     * @brief Elimina todas las mediciones y devuelve la memoria de los buffers
+     */
+    void vaciar() {
+        muestras.vaciar();
+        descartadas = 0;
+        for (int i = 0; i < N; i++) {
+            ventanas[i].inicio = 0;
+            ventanas[i].suma = 0;
+            ventanas[i].minimos.vaciar();
+            ventanas[i].maximos.vaciar();
+        }
+    }
+    
+    /**
+     * @brief Memoria reservada por el buffer comun y las colas monotonas
+     * @return Bytes de los buffers, sin contar el objeto
+     */
+    std::size_t bytesOcupados() const {
+        std::size_t bytes = muestras.bytesReservados();
+        for (int i = 0; i < N; i++) {
+            bytes += ventanas[i].minimos.bytesReservados() + ventanas[i].maximos.bytesReservados();
+        }
+        return bytes;
+    }
+    
+    long long getCantidad(int indice) const { return static_cast<long long>(getTotal() - ventanas[indice].inicio); }
+    bool estaVacia(int indice) const { return ventanas[indice].inicio == getTotal(); }
+    MarcaTiempo getDuracion(int indice) const { return ventanas[indice].duracion; }
+    
+    /**
+     * @brief Mediciones guardadas en el buffer comun (las de la ventana mas larga)
+     */
+    long long getRetenidas() const { return static_cast<long long>(muestras.getTamanio()); }
+};
+
+#endif // VENTANASDESLIZANTES_H
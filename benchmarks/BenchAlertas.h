@@ -0,0 +1,90 @@
+/**
+ * @file BenchAlertas.h
+ * @brief Pruebas de rendimiento del motor de alertas
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHALERTAS_H
+#define BENCHALERTAS_H
+
+#include "Benchmark.h"
+#include "MotorAlertas.h"
+#include "SensorTemperatura.h"
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Mide el costo por medicion de evaluar todas las reglas
+ * @param resultados Acumulador de metricas
+ * 
+ * 100 sensores reciben 10 millones de mediciones con todas las reglas
+ * activas y alrededor de 0.1% de valores anomalos. Un hilo consumidor
+ * vacia la cola en paralelo, como en la captura real.
+ */
+inline void ejecutarBenchAlertas(ResultadosBenchmark& resultados) {
+    const int sensores = 100;
+    const int cantidad = 10000000;
+    
+    std::vector<SensorTemperatura*> dispositivos;
+    for (int s = 0; s < sensores; s++) {
+        dispositivos.push_back(new SensorTemperatura("BENCH"));
+    }
+    
+    std::mt19937 generador(32);
+    std::normal_distribution<float> ruido(22.5f, 0.5f);
+    std::uniform_int_distribution<int> anomalia(0, 999);
+    std::vector<float> valores(cantidad);
+    for (int i = 0; i < cantidad; i++) {
+        valores[i] = anomalia(generador) == 0 ? 80.0f : ruido(generador);
+    }
+    
+    ReglasAlerta reglas;
+    reglas.maximo = 60.0;
+    reglas.minimo = -20.0;
+    reglas.tasaMaxima = 5.0;
+    reglas.puntajeZMaximo = 4.0;
+    reglas.repeticionesMaximas = 30;
+    
+    ColaSPSC<Alerta> cola(4096);
+    MotorAlertas motor(reglas, cola);
+    std::atomic<bool> activo(true);
+    unsigned long long consumidas = 0;
+    std::thread consumidor([&cola, &activo, &consumidas]() {
+        Alerta alerta;
+        while (activo.load(std::memory_order_acquire)) {
+            while (cola.intentarDesencolar(alerta)) {
+                consumidas++;
+            }
+        }
+        while (cola.intentarDesencolar(alerta)) {
+            consumidas++;
+        }
+    });
+    
+    long long encoladas = 0;
+    Cronometro cronometro;
+    for (int i = 0; i < cantidad; i++) {
+        encoladas += motor.evaluar(dispositivos[i % sensores], valores[i], static_cast<MarcaTiempo>(i) * 10);
+    }
+    const double segundos = cronometro.segundos();
+    activo.store(false, std::memory_order_release);
+    consumidor.join();
+    
+    resultados.registrar("alertas", "5_reglas_100_sensores", "evaluacion",
+                         segundos * 1e9 / cantidad, "ns/lectura");
+    resultados.registrar("alertas", "5_reglas_100_sensores", "alertas_emitidas",
+                         static_cast<double>(encoladas), "alertas");
+    resultados.registrar("alertas", "5_reglas_100_sensores", "alertas_descartadas",
+                         static_cast<double>(cola.getDescartados()), "alertas");
+    conservarResultado(consumidas);
+    
+    for (int s = 0; s < sensores; s++) {
+        delete dispositivos[s];
+    }
+}
+
+#endif // BENCHALERTAS_H
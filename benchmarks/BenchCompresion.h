@@ -0,0 +1,205 @@
+/**
+ * @file BenchCompresion.h
+ * @brief Pruebas de rendimiento de la compresion de historiales
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHCOMPRESION_H
+#define BENCHCOMPRESION_H
+
+#include "Benchmark.h"
+#include "HistorialGorilla.h"
+#include "HistorialEmpaquetado.h"
+#include "Nodo.h"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Serie sintetica de temperaturas con sus marcas de tiempo
+ */
+struct SerieTemperatura {
+    std::vector<MarcaTiempo> marcas;  ///< Marcas en milisegundos
+    std::vector<float> valores;       ///< Temperaturas en grados Celsius
+};
+
+/**
+ * @brief Genera una serie sintetica de temperaturas
+ * @param cantidad Numero de mediciones
+ * @param perfil 0: estable con resolucion de 1 grado, 1: paseo aleatorio de 0.1 grados,
+ *               2: ruido gaussiano de precision completa
+ * @return Serie con muestreo de 1 s y fluctuacion ocasional de pocos milisegundos
+ */
+inline SerieTemperatura generarSerieTemperatura(int cantidad, int perfil) {
+    std::mt19937 generador(20240 + perfil);
+    std::uniform_int_distribution<int> fluctuacion(-3, 3);
+    std::uniform_int_distribution<int> paso(-1, 1);
+    std::uniform_real_distribution<double> probabilidad(0.0, 1.0);
+    std::normal_distribution<float> ruido(0.0f, 0.4f);
+    
+    SerieTemperatura serie;
+    serie.marcas.reserve(cantidad);
+    serie.valores.reserve(cantidad);
+    MarcaTiempo marca = 1000000;
+    int decimas = 225;
+    for (int i = 0; i < cantidad; i++) {
+        marca += 1000 + (probabilidad(generador) < 0.1 ? fluctuacion(generador) : 0);
+        float valor;
+        if (perfil == 0) {
+            if (probabilidad(generador) < 0.05) {
+                decimas += 10 * paso(generador);
+            }
+            valor = static_cast<float>(decimas / 10);
+        } else if (perfil == 1) {
+            decimas += paso(generador);
+            valor = static_cast<float>(decimas) / 10.0f;
+        } else {
+            valor = 22.5f + ruido(generador);
+        }
+        serie.marcas.push_back(marca);
+        serie.valores.push_back(valor);
+    }
+    return serie;
+}
+
+/**
+ * @brief Mide tasa de compresion y velocidad de codificacion y decodificacion Gorilla
+ * @param resultados Acumulador de metricas
+ */
+inline void ejecutarBenchCompresionGorilla(ResultadosBenchmark& resultados) {
+    const int cantidad = 1000000;
+    const char* perfiles[] = { "temperatura_estable", "temperatura_paseo_0.1", "temperatura_ruidosa" };
+    
+    for (int perfil = 0; perfil < 3; perfil++) {
+        const SerieTemperatura serie = generarSerieTemperatura(cantidad, perfil);
+        
+        HistorialGorilla historial;
+        Cronometro cronometro;
+        for (int i = 0; i < cantidad; i++) {
+            historial.agregar(serie.marcas[i], serie.valores[i]);
+        }
+        const double segundosCodificacion = cronometro.segundos();
+        
+        float minimo = 999999.0f;
+        cronometro.reiniciar();
+        historial.iterar([&minimo](MarcaTiempo, float valor) {
+            if (valor < minimo) {
+                minimo = valor;
+            }
+        });
+        const double segundosDecodificacion = cronometro.segundos();
+        conservarResultado(minimo);
+        
+        // Verificacion de que la codificacion no pierde informacion
+        std::size_t indice = 0;
+        bool exacta = true;
+        historial.iterar([&serie, &indice, &exacta](MarcaTiempo marca, float valor) {
+            if (marca != serie.marcas[indice] || valor != serie.valores[indice]) {
+                exacta = false;
+            }
+            indice++;
+        });
+        if (!exacta || indice != serie.valores.size()) {
+            std::cerr << "[ERROR] La decodificacion Gorilla no reproduce la serie " << perfiles[perfil] << std::endl;
+            std::exit(1);
+        }
+        
+        resultados.registrar("compresion", perfiles[perfil], "bytes_por_lectura",
+                             static_cast<double>(historial.bytesOcupados()) / cantidad, "B");
+        resultados.registrar("compresion", perfiles[perfil], "bytes_por_lectura_lista",
+                             static_cast<double>(sizeof(Nodo<float>)), "B");
+        resultados.registrar("compresion", perfiles[perfil], "codificacion",
+                             segundosCodificacion * 1e9 / cantidad, "ns/lectura");
+        resultados.registrar("compresion", perfiles[perfil], "decodificacion_minimo",
+                             segundosDecodificacion * 1e9 / cantidad, "ns/lectura");
+    }
+}
+
+/**
+ * @brief Genera una serie sintetica de presiones
+ * @param cantidad Numero de mediciones
+ * @param amplitudRuido Variacion maxima entre lecturas consecutivas, en Pascales
+ * @return Presiones alrededor de 101325 Pa con deriva lenta
+ */
+inline std::vector<int32_t> generarSeriePresion(int cantidad, int amplitudRuido) {
+    std::mt19937 generador(1013 + amplitudRuido);
+    std::uniform_int_distribution<int> ruido(-amplitudRuido, amplitudRuido);
+    std::vector<int32_t> serie;
+    serie.reserve(cantidad);
+    int32_t valor = 101325;
+    for (int i = 0; i < cantidad; i++) {
+        valor += ruido(generador);
+        serie.push_back(valor);
+    }
+    return serie;
+}
+
+/**
+ * @brief Mide tasa de compresion, decodificacion y media del empaquetado por bloques
+ * @param resultados Acumulador de metricas
+ */
+inline void ejecutarBenchEmpaquetadoPresion(ResultadosBenchmark& resultados) {
+    const int cantidad = 1000000;
+    const int amplitudes[] = { 2, 20, 500 };
+    const char* casos[] = { "presion_ruido_2Pa", "presion_ruido_20Pa", "presion_ruido_500Pa" };
+    const int bloque = HistorialEmpaquetado::TAMANIO_BLOQUE;
+    
+    for (int caso = 0; caso < 3; caso++) {
+        const std::vector<int32_t> serie = generarSeriePresion(cantidad, amplitudes[caso]);
+        std::vector<MarcaTiempo> marcas(cantidad);
+        for (int i = 0; i < cantidad; i++) {
+            marcas[i] = static_cast<MarcaTiempo>(i) * 1000;
+        }
+        
+        HistorialEmpaquetado historial;
+        Cronometro cronometro;
+        for (int i = 0; i < cantidad; i += bloque) {
+            historial.agregarBloque(serie.data() + i, marcas.data() + i, cantidad - i < bloque ? cantidad - i : bloque);
+        }
+        const double segundosCodificacion = cronometro.segundos();
+        
+        long long sumaDecodificada = 0;
+        cronometro.reiniciar();
+        historial.iterar([&sumaDecodificada](int valor) {
+            sumaDecodificada += valor;
+        });
+        const double segundosDecodificacion = cronometro.segundos();
+        
+        cronometro.reiniciar();
+        const long long sumaCabeceras = historial.sumar();
+        const double segundosMedia = cronometro.segundos();
+        
+        long long sumaEsperada = 0;
+        std::size_t indice = 0;
+        bool exacta = true;
+        for (int i = 0; i < cantidad; i++) {
+            sumaEsperada += serie[i];
+        }
+        historial.iterar([&serie, &indice, &exacta](int valor) {
+            if (valor != serie[indice]) {
+                exacta = false;
+            }
+            indice++;
+        });
+        if (!exacta || sumaDecodificada != sumaEsperada || sumaCabeceras != sumaEsperada) {
+            std::cerr << "[ERROR] El empaquetado no reproduce la serie " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        resultados.registrar("compresion", casos[caso], "bytes_por_lectura",
+                             static_cast<double>(historial.bytesOcupados()) / cantidad, "B");
+        resultados.registrar("compresion", casos[caso], "bytes_por_lectura_lista",
+                             static_cast<double>(sizeof(Nodo<int>)), "B");
+        resultados.registrar("compresion", casos[caso], "codificacion",
+                             segundosCodificacion * 1e9 / cantidad, "ns/lectura");
+        resultados.registrar("compresion", casos[caso], "decodificacion_suma",
+                             segundosDecodificacion * 1e9 / cantidad, "ns/lectura");
+        resultados.registrar("compresion", casos[caso], "media_por_cabeceras",
+                             segundosMedia * 1e9 / cantidad, "ns/lectura");
+    }
+}
+
+#endif // BENCHCOMPRESION_H
@@ -0,0 +1,136 @@
+/**
+ * @file BenchConcurrencia.h
+ * @brief Pruebas de rendimiento de lecturas concurrentes durante la captura
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHCONCURRENCIA_H
+#define BENCHCONCURRENCIA_H
+
+#include "Benchmark.h"
+#include "ListaConcurrente.h"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Resultado de una serie de lecturas concurrentes
+ */
+struct ConteoLecturas {
+    long long recorridos;  ///< Lecturas completas
+    long long elementos;   ///< Elementos visitados
+    long long rupturas;    ///< Recorridos con un hueco en la secuencia
+    long long excesos;     ///< Recorridos que pasaron de su instantanea
+    
+    ConteoLecturas() : recorridos(0), elementos(0), rupturas(0), excesos(0) {}
+};
+
+/**
+ * @brief Mide el rendimiento de lectores que recorren la lista mientras un escritor agrega
+ * @param resultados Acumulador de metricas
+ * 
+ * El escritor agrega enteros consecutivos sin pausa y retira por el frente
+ * para mantener una ventana fija, como el nivel reciente de un sensor; una
+ * vez por tanda retira ademas la cola con eliminarSi y vuelve a agregar el
+ * mismo valor en un nodo nuevo. Cada lector verifica que su recorrido sea
+ * una secuencia sin huecos y que no supere ventana + 1 elementos: un hueco
+ * indicaria una instantanea inconsistente, y un exceso, un recorrido que
+ * siguio de largo tras la cola retirada. Se duplica la cantidad de
+ * lectores hasta ocupar los nucleos que deja libres el escritor.
+ */
+inline void ejecutarBenchConcurrencia(ResultadosBenchmark& resultados) {
+    const int ventana = 4096;
+    const double duracion = 0.5;
+    const unsigned nucleos = std::thread::hardware_concurrency();
+    const int lectoresMaximos = nucleos > 3 ? static_cast<int>(nucleos) - 1 : 2;
+    
+    for (int lectores = 0; lectores <= lectoresMaximos; lectores = lectores == 0 ? 1 : lectores * 2) {
+        ListaConcurrente<long long> lista;
+        for (long long i = 0; i < ventana; i++) {
+            lista.insertarAlFinal(i);
+        }
+        std::atomic<bool> detener(false);
+        std::vector<ConteoLecturas> conteos(static_cast<std::size_t>(lectores));
+        std::vector<std::thread> hilos;
+        for (int l = 0; l < lectores; l++) {
+            ConteoLecturas* conteo = &conteos[static_cast<std::size_t>(l)];
+            hilos.push_back(std::thread([&lista, &detener, conteo]() {
+                ConteoLecturas local;
+                while (!detener.load(std::memory_order_relaxed)) {
+                    long long anterior = -1;
+                    bool continua = true;
+                    const int visitados = lista.iterar([&anterior, &continua](const long long& valor) {
+                        if (anterior >= 0 && valor != anterior + 1) {
+                            continua = false;
+                        }
+                        anterior = valor;
+                    });
+                    local.elementos += visitados;
+                    local.recorridos++;
+                    if (!continua) {
+                        local.rupturas++;
+                    }
+                    if (visitados > ventana + 1) {
+                        local.excesos++;
+                    }
+                }
+                *conteo = local;
+            }));
+        }
+        
+        long long agregados = 0;
+        long long siguiente = ventana;
+        Cronometro cronometro;
+        while (cronometro.segundos() < duracion) {
+            for (int i = 0; i < 1023; i++) {
+                lista.insertarAlFinal(siguiente++);
+                lista.eliminarPrimero();
+            }
+            // Cola retirada y reemplazada mientras los lectores la usan de limite
+            const long long reemplazado = siguiente++;
+            lista.insertarAlFinal(reemplazado);
+            lista.eliminarSi([reemplazado](const long long& valor) { return valor == reemplazado; });
+            lista.insertarAlFinal(reemplazado);
+            lista.eliminarPrimero();
+            agregados += 1024;
+        }
+        const double segundos = cronometro.segundos();
+        detener.store(true);
+        for (std::size_t h = 0; h < hilos.size(); h++) {
+            hilos[h].join();
+        }
+        
+        ConteoLecturas total;
+        for (std::size_t l = 0; l < conteos.size(); l++) {
+            total.recorridos += conteos[l].recorridos;
+            total.elementos += conteos[l].elementos;
+            total.rupturas += conteos[l].rupturas;
+            total.excesos += conteos[l].excesos;
+        }
+        if (total.rupturas > 0 || total.excesos > 0 || lista.getTamanio() != ventana) {
+            std::cerr << "[ERROR] Lectura concurrente inconsistente con " << lectores
+                      << " lectores (" << total.rupturas << " recorridos con huecos, "
+                      << total.excesos << " fuera de su instantanea)" << std::endl;
+            std::exit(1);
+        }
+        lista.recolectar();
+        
+        std::ostringstream caso;
+        caso << lectores << "_lectores";
+        resultados.registrar("ListaConcurrente", caso.str(), "escritor",
+                             agregados / segundos, "agregados/s");
+        if (lectores > 0) {
+            resultados.registrar("ListaConcurrente", caso.str(), "recorridos",
+                                 total.recorridos / segundos, "recorridos/s");
+            resultados.registrar("ListaConcurrente", caso.str(), "elementos_leidos",
+                                 total.elementos / segundos, "elem/s");
+        }
+    }
+}
+
+#endif // BENCHCONCURRENCIA_H
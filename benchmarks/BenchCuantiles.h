@@ -0,0 +1,107 @@
+/**
+ * @file BenchCuantiles.h
+ * @brief Pruebas de rendimiento y precision del boceto de percentiles
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHCUANTILES_H
+#define BENCHCUANTILES_H
+
+#include "Benchmark.h"
+#include "BocetoCuantiles.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Error de rango de una estimacion respecto de los datos ordenados
+ * @param ordenados Serie completa ordenada
+ * @param estimado Valor devuelto por el boceto
+ * @param q Cuantil solicitado
+ * @return Distancia entre el rango del valor estimado y q, como fraccion
+ */
+inline double errorDeRango(const std::vector<float>& ordenados, float estimado, double q) {
+    const double menores = static_cast<double>(
+        std::lower_bound(ordenados.begin(), ordenados.end(), estimado) - ordenados.begin());
+    const double hastaIgual = static_cast<double>(
+        std::upper_bound(ordenados.begin(), ordenados.end(), estimado) - ordenados.begin());
+    const double objetivo = q * static_cast<double>(ordenados.size());
+    if (objetivo < menores) {
+        return (menores - objetivo) / ordenados.size();
+    }
+    if (objetivo > hastaIgual) {
+        return (objetivo - hastaIgual) / ordenados.size();
+    }
+    return 0.0;
+}
+
+/**
+ * @brief Mide insercion, memoria, error y combinacion del boceto para varias precisiones
+ * @param resultados Acumulador de metricas
+ * 
+ * Una flota de 100 sensores recibe 20000 mediciones cada uno; los
+ * percentiles de la flota se obtienen combinando los 100 bocetos y se
+ * comparan con el orden exacto de las 2 millones de mediciones.
+ */
+inline void ejecutarBenchCuantiles(ResultadosBenchmark& resultados) {
+    const int sensores = 100;
+    const int porSensor = 20000;
+    const int precisiones[] = { 50, 200, 800 };
+    const char* casos[] = { "kll_k50", "kll_k200", "kll_k800" };
+    const double cuantiles[] = { 0.50, 0.95, 0.99 };
+    
+    std::mt19937 generador(31);
+    std::vector<float> serie(static_cast<std::size_t>(sensores) * porSensor);
+    for (int s = 0; s < sensores; s++) {
+        std::normal_distribution<float> ruido(20.0f + s * 0.05f, 3.0f);
+        for (int i = 0; i < porSensor; i++) {
+            serie[static_cast<std::size_t>(s) * porSensor + i] = ruido(generador);
+        }
+    }
+    std::vector<float> ordenados(serie);
+    std::sort(ordenados.begin(), ordenados.end());
+    
+    for (int caso = 0; caso < 3; caso++) {
+        std::vector<BocetoCuantiles<float> > bocetos(sensores, BocetoCuantiles<float>(precisiones[caso]));
+        Cronometro cronometro;
+        for (int s = 0; s < sensores; s++) {
+            for (int i = 0; i < porSensor; i++) {
+                bocetos[s].agregar(serie[static_cast<std::size_t>(s) * porSensor + i]);
+            }
+        }
+        const double segundosInsercion = cronometro.segundos();
+        
+        cronometro.reiniciar();
+        BocetoCuantiles<float> flota(precisiones[caso]);
+        for (int s = 0; s < sensores; s++) {
+            flota.combinar(bocetos[s]);
+        }
+        const double segundosCombinacion = cronometro.segundos();
+        
+        if (flota.getCantidad() != static_cast<long long>(serie.size())) {
+            std::cerr << "[ERROR] La combinacion de bocetos perdio mediciones en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        double peorError = 0.0;
+        for (int c = 0; c < 3; c++) {
+            peorError = std::max(peorError, errorDeRango(ordenados, flota.cuantil(cuantiles[c]), cuantiles[c]));
+        }
+        
+        resultados.registrar("cuantiles", casos[caso], "insercion",
+                             segundosInsercion * 1e9 / serie.size(), "ns/lectura");
+        resultados.registrar("cuantiles", casos[caso], "bytes_por_sensor",
+                             static_cast<double>(bocetos[0].bytesOcupados()), "B");
+        resultados.registrar("cuantiles", casos[caso], "combinacion_100_sensores",
+                             segundosCombinacion * 1e6, "us");
+        resultados.registrar("cuantiles", casos[caso], "error_rango_p50_p95_p99",
+                             peorError * 100.0, "%");
+    }
+}
+
+#endif // BENCHCUANTILES_H
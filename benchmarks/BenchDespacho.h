@@ -0,0 +1,136 @@
+/**
+ * @file BenchDespacho.h
+ * @brief Pruebas de rendimiento de la resolucion del tipo de sensor en la ingesta
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHDESPACHO_H
+#define BENCHDESPACHO_H
+
+#include "Benchmark.h"
+#include "SensorTemperatura.h"
+#include "SensorPresion.h"
+#include <random>
+#include <vector>
+
+/**
+ * @brief Medicion sintetica dirigida a un sensor del registro
+ */
+struct LecturaDirigida {
+    int sensor;    ///< Posicion del sensor destino
+    double valor;  ///< Medicion
+};
+
+/**
+ * @brief Compara la resolucion de tipo por dynamic_cast, por etiqueta y por llamada virtual
+ * @param resultados Acumulador de metricas
+ * 
+ * Un registro mixto de 100 sensores recibe mediciones en orden aleatorio.
+ * La variante "solo_despacho" aisla el costo de resolver el tipo; la
+ * variante "ingesta" incluye agregarLectura completo, como en la captura serial.
+ */
+inline void ejecutarBenchDespacho(ResultadosBenchmark& resultados) {
+    const int sensores = 100;
+    const int cantidad = 2000000;
+    
+    std::vector<SensorBase*> registro;
+    for (int s = 0; s < sensores; s++) {
+        if (s % 2 == 0) {
+            registro.push_back(new SensorTemperatura("BENCH-T"));
+        } else {
+            registro.push_back(new SensorPresion("BENCH-P"));
+        }
+    }
+    
+    std::mt19937 generador(33);
+    std::uniform_int_distribution<int> destino(0, sensores - 1);
+    std::normal_distribution<double> ruido(0.0, 1.0);
+    std::vector<LecturaDirigida> lecturas(cantidad);
+    for (int i = 0; i < cantidad; i++) {
+        lecturas[i].sensor = destino(generador);
+        lecturas[i].valor = registro[lecturas[i].sensor]->getTipo() == SENSOR_TEMPERATURA
+                                ? 22.5 + ruido(generador) : 101325.0 + 50.0 * ruido(generador);
+    }
+    
+    // Solo despacho: resolver el tipo y acumular el valor convertido
+    double suma = 0.0;
+    Cronometro cronometro;
+    for (int i = 0; i < cantidad; i++) {
+        SensorBase* dispositivo = registro[lecturas[i].sensor];
+        if (SensorTemperatura* termico = dynamic_cast<SensorTemperatura*>(dispositivo)) {
+            suma += static_cast<float>(lecturas[i].valor);
+            conservarResultado(termico);
+        } else if (SensorPresion* presion = dynamic_cast<SensorPresion*>(dispositivo)) {
+            suma += static_cast<int>(lecturas[i].valor);
+            conservarResultado(presion);
+        }
+    }
+    const double segundosCast = cronometro.segundos();
+    
+    cronometro.reiniciar();
+    for (int i = 0; i < cantidad; i++) {
+        SensorBase* dispositivo = registro[lecturas[i].sensor];
+        if (dispositivo->getTipo() == SENSOR_TEMPERATURA) {
+            SensorTemperatura* termico = static_cast<SensorTemperatura*>(dispositivo);
+            suma += static_cast<float>(lecturas[i].valor);
+            conservarResultado(termico);
+        } else {
+            SensorPresion* presion = static_cast<SensorPresion*>(dispositivo);
+            suma += static_cast<int>(lecturas[i].valor);
+            conservarResultado(presion);
+        }
+    }
+    const double segundosEtiqueta = cronometro.segundos();
+    conservarResultado(suma);
+    
+    // Ingesta completa por cada via
+    MarcaTiempo marca = 0;
+    cronometro.reiniciar();
+    for (int i = 0; i < cantidad; i++) {
+        SensorBase* dispositivo = registro[lecturas[i].sensor];
+        if (SensorTemperatura* termico = dynamic_cast<SensorTemperatura*>(dispositivo)) {
+            termico->agregarLectura(static_cast<float>(lecturas[i].valor), ++marca);
+        } else if (SensorPresion* presion = dynamic_cast<SensorPresion*>(dispositivo)) {
+            presion->agregarLectura(static_cast<int>(lecturas[i].valor), ++marca);
+        }
+    }
+    const double segundosIngestaCast = cronometro.segundos();
+    
+    cronometro.reiniciar();
+    for (int i = 0; i < cantidad; i++) {
+        SensorBase* dispositivo = registro[lecturas[i].sensor];
+        if (dispositivo->getTipo() == SENSOR_TEMPERATURA) {
+            SensorTemperatura* termico = static_cast<SensorTemperatura*>(dispositivo);
+            termico->agregarLectura(static_cast<float>(lecturas[i].valor), ++marca);
+        } else {
+            SensorPresion* presion = static_cast<SensorPresion*>(dispositivo);
+            presion->agregarLectura(static_cast<int>(lecturas[i].valor), ++marca);
+        }
+    }
+    const double segundosIngestaEtiqueta = cronometro.segundos();
+    
+    cronometro.reiniciar();
+    for (int i = 0; i < cantidad; i++) {
+        registro[lecturas[i].sensor]->agregarLecturaGenerica(lecturas[i].valor, ++marca);
+    }
+    const double segundosIngestaVirtual = cronometro.segundos();
+    
+    resultados.registrar("despacho", "solo_despacho", "dynamic_cast",
+                         segundosCast * 1e9 / cantidad, "ns/lectura");
+    resultados.registrar("despacho", "solo_despacho", "etiqueta",
+                         segundosEtiqueta * 1e9 / cantidad, "ns/lectura");
+    resultados.registrar("despacho", "ingesta", "dynamic_cast",
+                         segundosIngestaCast * 1e9 / cantidad, "ns/lectura");
+    resultados.registrar("despacho", "ingesta", "etiqueta",
+                         segundosIngestaEtiqueta * 1e9 / cantidad, "ns/lectura");
+    resultados.registrar("despacho", "ingesta", "virtual_generica",
+                         segundosIngestaVirtual * 1e9 / cantidad, "ns/lectura");
+    
+    for (int s = 0; s < sensores; s++) {
+        delete registro[s];
+    }
+}
+
+#endif // BENCHDESPACHO_H
@@ -0,0 +1,88 @@
+/**
+ * @file BenchIngesta.h
+ * @brief Reproduccion de un flujo serial sintetico por la ruta completa de captura
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHINGESTA_H
+#define BENCHINGESTA_H
+
+#include "Benchmark.h"
+#include "IngestaSerial.h"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Mide interpretacion, busqueda, insercion y alertas por linea recibida
+ * @param resultados Acumulador de metricas
+ * 
+ * Las lineas siguen el formato del Arduino ("T id valor" y "P id valor"),
+ * intercaladas con sus mensajes de sistema, y se entregan a IngestaSerial
+ * tal como lo hace capturarDatosHardware. Se reproducen flotas de distinto
+ * tamanio porque la busqueda del sensor recorre la coleccion.
+ */
+inline void ejecutarBenchIngesta(ResultadosBenchmark& resultados) {
+    const int lineas = 200000;
+    const int flotas[] = { 10, 100, 1000 };
+    const char* casos[] = { "serial_10_sensores", "serial_100_sensores", "serial_1000_sensores" };
+    
+    for (int caso = 0; caso < 3; caso++) {
+        const int sensores = flotas[caso];
+        std::mt19937 generador(7 + caso);
+        std::uniform_int_distribution<int> elegido(0, sensores - 1);
+        std::normal_distribution<float> temperatura(22.5f, 2.0f);
+        std::normal_distribution<float> presion(101325.0f, 300.0f);
+        
+        std::vector<std::string> flujo;
+        flujo.reserve(lineas + lineas / 100 + 1);
+        flujo.push_back("=== Arduino Sensor Simulator ===");
+        for (int i = 0; i < lineas; i++) {
+            if (i % 100 == 0) {
+                flujo.push_back("Formato: TIPO ID VALOR");
+            }
+            const int s = elegido(generador);
+            std::ostringstream linea;
+            if (s % 2 == 0) {
+                linea << "T TEMP-" << caso << "-" << s << " " << temperatura(generador);
+            } else {
+                linea << "P PRES-" << caso << "-" << s << " " << static_cast<int>(presion(generador));
+            }
+            flujo.push_back(linea.str());
+        }
+        
+        RegistroSensores registro;
+        ColaSPSC<Alerta> cola(1 << 16);
+        MotorAlertas alertasTermicas(ReglasAlerta(), cola);
+        MotorAlertas alertasPresion(ReglasAlerta(), cola);
+        IngestaSerial ingesta(&registro, alertasTermicas, alertasPresion);
+        
+        int aceptadas = 0;
+        Cronometro cronometro;
+        for (std::size_t i = 0; i < flujo.size(); i++) {
+            aceptadas += ingesta.procesarLinea(flujo[i]);
+        }
+        const double segundos = cronometro.segundos();
+        
+        long long almacenadas = 0;
+        registro.getColeccion()->iterar([&almacenadas](SensorBase* dispositivo) {
+            almacenadas += dispositivo->getCantidadMediciones();
+        });
+        if (aceptadas != lineas || almacenadas != lineas || registro.getTamanio() > sensores) {
+            std::cerr << "[ERROR] La reproduccion serial perdio mediciones en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        resultados.registrar("ingesta", casos[caso], "procesarLinea",
+                             segundos * 1e9 / flujo.size(), "ns/linea");
+        resultados.registrar("ingesta", casos[caso], "rendimiento",
+                             lineas / segundos, "mediciones/s");
+    }
+}
+
+#endif // BENCHINGESTA_H
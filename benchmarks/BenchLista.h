@@ -0,0 +1,315 @@
+/**
+ * @file BenchLista.h
+ * @brief Pruebas de rendimiento de las operaciones basicas de ListaSensor
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHLISTA_H
+#define BENCHLISTA_H
+
+#include "Benchmark.h"
+#include "ListaSensor.h"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Mide buscarSi con cada politica sobre un flujo de busquedas sesgado
+ * @param resultados Acumulador de metricas
+ * 
+ * Imita la ingesta serial: 1000 elementos, de los cuales 8 reciben el 90%
+ * de las busquedas, en rachas de 4 busquedas consecutivas del mismo
+ * elemento. Los elementos frecuentes se insertan al final, el peor caso
+ * para el recorrido secuencial.
+ */
+inline void medirPoliticasBusqueda(ResultadosBenchmark& resultados) {
+    const int cantidad = 1000;
+    const int frecuentes = 8;
+    const int busquedas = 2000000;
+    const PoliticaBusqueda politicas[] = { BUSQUEDA_SECUENCIAL, BUSQUEDA_ULTIMO_ACIERTO, BUSQUEDA_MOVER_AL_FRENTE };
+    const char* nombres[] = { "buscarSi_secuencial", "buscarSi_ultimo_acierto", "buscarSi_mover_al_frente" };
+    
+    std::mt19937 generador(131);
+    std::uniform_real_distribution<double> sorteo(0.0, 1.0);
+    std::uniform_int_distribution<int> caliente(cantidad - frecuentes, cantidad - 1);
+    std::uniform_int_distribution<int> cualquiera(0, cantidad - 1);
+    std::vector<int> objetivos(busquedas);
+    for (int i = 0; i < busquedas; i += 4) {
+        const int elegido = sorteo(generador) < 0.9 ? caliente(generador) : cualquiera(generador);
+        for (int r = 0; r < 4 && i + r < busquedas; r++) {
+            objetivos[i + r] = elegido;
+        }
+    }
+    
+    for (int p = 0; p < 3; p++) {
+        ListaSensor<int> lista;
+        for (int i = 0; i < cantidad; i++) {
+            lista.insertarAlFinal(i);
+        }
+        lista.setPoliticaBusqueda(politicas[p]);
+        
+        long long suma = 0;
+        long long esperada = 0;
+        Cronometro cronometro;
+        for (int i = 0; i < busquedas; i++) {
+            const int objetivo = objetivos[i];
+            Nodo<int>* nodo = lista.buscarSi([objetivo](int dato) { return dato == objetivo; });
+            suma += nodo != nullptr ? nodo->dato : -1;
+        }
+        const double segundos = cronometro.segundos();
+        for (int i = 0; i < busquedas; i++) {
+            esperada += objetivos[i];
+        }
+        if (suma != esperada || lista.getTamanio() != cantidad) {
+            std::cerr << "[ERROR] buscarSi devolvio elementos incorrectos con " << nombres[p] << std::endl;
+            std::exit(1);
+        }
+        resultados.registrar("lista", "sesgada_1k", nombres[p], segundos * 1e9 / busquedas, "ns/busqueda");
+    }
+}
+
+/**
+ * @brief Medicion con un constructor de copia propio: obliga a ListaSensor a la ruta general
+ */
+struct MedicionEnvuelta {
+    double valor;  ///< Medicion
+    
+    explicit MedicionEnvuelta(double v = 0.0) : valor(v) {}
+    MedicionEnvuelta(const MedicionEnvuelta& otra) : valor(otra.valor) {}
+    MedicionEnvuelta& operator=(const MedicionEnvuelta& otra) {
+        valor = otra.valor;
+        return *this;
+    }
+};
+
+/**
+ * @brief Copia y vacia repetidamente una lista de origen
+ * @param origen Lista a copiar
+ * @param repeticiones Copias realizadas
+ * @param segundosCopia Tiempo acumulado de las copias
+ * @param segundosVaciado Tiempo acumulado de los vaciados
+ */
+template <typename T>
+void medirCopiaYVaciado(const ListaSensor<T>& origen, int repeticiones,
+                        double& segundosCopia, double& segundosVaciado) {
+    segundosCopia = 0.0;
+    segundosVaciado = 0.0;
+    for (int r = 0; r < repeticiones; r++) {
+        Cronometro cronometro;
+        ListaSensor<T> copia(origen);
+        segundosCopia += cronometro.segundos();
+        if (copia.getTamanio() != origen.getTamanio()) {
+            std::cerr << "[ERROR] Copia incompleta de un historial numerico" << std::endl;
+            std::exit(1);
+        }
+        cronometro.reiniciar();
+        copia.vaciar();
+        segundosVaciado += cronometro.segundos();
+    }
+}
+
+/**
+ * @brief Compara la copia y el vaciado de un historial numerico con la ruta general
+ * @param resultados Acumulador de metricas
+ * 
+ * ListaSensor<double> cumple ElementoTrivial: copia byte a byte sobre una
+ * cadena del pool y devuelve la cadena entera al vaciar. MedicionEnvuelta
+ * ocupa lo mismo pero declara su constructor de copia, de modo que recorre
+ * la ruta general de un nodo construido y destruido por elemento. Se usa
+ * double y no float porque ningun otro caso usa ese pool: ambas variantes
+ * parten de bloques recien reservados y no del orden que dejaron las
+ * suites anteriores en los nodos libres.
+ */
+inline void medirCopiaTrivial(ResultadosBenchmark& resultados) {
+    const int cantidad = 100000;
+    const int repeticiones = 50;
+    ListaSensor<double> numerica;
+    ListaSensor<MedicionEnvuelta> envuelta;
+    for (int i = 0; i < cantidad; i++) {
+        numerica.insertarAlFinal(0.5 * i);
+        envuelta.insertarAlFinal(MedicionEnvuelta(0.5 * i));
+    }
+    
+    double copiaTrivial = 0.0;
+    double vaciadoTrivial = 0.0;
+    double copiaGeneral = 0.0;
+    double vaciadoGeneral = 0.0;
+    medirCopiaYVaciado(numerica, repeticiones, copiaTrivial, vaciadoTrivial);
+    medirCopiaYVaciado(envuelta, repeticiones, copiaGeneral, vaciadoGeneral);
+    
+    const double elementos = static_cast<double>(cantidad) * repeticiones;
+    resultados.registrar("lista", "double_100k", "copia_trivial", copiaTrivial * 1e9 / elementos, "ns/elemento");
+    resultados.registrar("lista", "double_100k", "copia_general", copiaGeneral * 1e9 / elementos, "ns/elemento");
+    resultados.registrar("lista", "double_100k", "vaciar_trivial", vaciadoTrivial * 1e9 / elementos, "ns/elemento");
+    resultados.registrar("lista", "double_100k", "vaciar_general", vaciadoGeneral * 1e9 / elementos, "ns/elemento");
+}
+
+/**
+ * @brief Mide insercion, empalme, division, busqueda, recorrido, copia, eliminacion y vaciado para varios tamanios
+ * @param resultados Acumulador de metricas
+ * 
+ * Cada tamanio se mide sobre una lista nueva de enteros consecutivos. Las
+ * busquedas solicitan elementos presentes elegidos al azar; su cantidad
+ * se ajusta para recorrer del orden de 10^7 nodos por tamanio.
+ */
+inline void ejecutarBenchLista(ResultadosBenchmark& resultados) {
+    const int tamanios[] = { 1000, 10000, 100000, 1000000 };
+    const char* casos[] = { "int_1k", "int_10k", "int_100k", "int_1M" };
+    
+    for (int caso = 0; caso < 4; caso++) {
+        const int cantidad = tamanios[caso];
+        ListaSensor<int> lista;
+        
+        Cronometro cronometro;
+        for (int i = 0; i < cantidad; i++) {
+            lista.insertarAlFinal(i);
+        }
+        const double segundosInsercion = cronometro.segundos();
+        if (lista.getTamanio() != cantidad) {
+            std::cerr << "[ERROR] La lista perdio elementos en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        std::vector<int> valores(cantidad);
+        for (int i = 0; i < cantidad; i++) {
+            valores[i] = cantidad + i;
+        }
+        ListaSensor<int> lote;
+        cronometro.reiniciar();
+        lote.insertarRango(valores.begin(), valores.end());
+        const double segundosRango = cronometro.segundos();
+        
+        cronometro.reiniciar();
+        lista.empalmar(lote);
+        const double segundosEmpalme = cronometro.segundos();
+        if (lista.getTamanio() != 2 * cantidad || !lote.estaVacia()) {
+            std::cerr << "[ERROR] Empalme incompleto en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        cronometro.reiniciar();
+        const bool dividida = lista.dividir(cantidad, lote);
+        const double segundosDivision = cronometro.segundos();
+        if (!dividida || lista.getTamanio() != cantidad || lote.getTamanio() != cantidad ||
+            lote.getCabeza()->dato != cantidad) {
+            std::cerr << "[ERROR] Division incorrecta en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        lote.vaciar();
+        
+        const int busquedas = 20000000 / cantidad < 20 ? 20 : 20000000 / cantidad;
+        std::mt19937 generador(97 + caso);
+        std::uniform_int_distribution<int> posicion(0, cantidad - 1);
+        std::vector<int> objetivos(busquedas);
+        for (int i = 0; i < busquedas; i++) {
+            objetivos[i] = posicion(generador);
+        }
+        int encontrados = 0;
+        cronometro.reiniciar();
+        for (int i = 0; i < busquedas; i++) {
+            encontrados += lista.buscar(objetivos[i]) != nullptr;
+        }
+        const double segundosBusqueda = cronometro.segundos();
+        if (encontrados != busquedas) {
+            std::cerr << "[ERROR] Busqueda fallida en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        const int recorridos = 20000000 / cantidad < 1 ? 1 : 20000000 / cantidad;
+        long long suma = 0;
+        cronometro.reiniciar();
+        for (int r = 0; r < recorridos; r++) {
+            lista.iterar([&suma](int dato) {
+                suma += dato;
+            });
+            conservarResultado(suma);
+        }
+        const double segundosRecorrido = cronometro.segundos();
+        const long long esperada = static_cast<long long>(cantidad) * (cantidad - 1) / 2 * recorridos;
+        if (suma != esperada) {
+            std::cerr << "[ERROR] Recorrido incompleto en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        long long sumaIterador = 0;
+        cronometro.reiniciar();
+        for (int r = 0; r < recorridos; r++) {
+            for (int dato : lista) {
+                sumaIterador += dato;
+            }
+            conservarResultado(sumaIterador);
+        }
+        const double segundosIterador = cronometro.segundos();
+        if (sumaIterador != esperada) {
+            std::cerr << "[ERROR] Recorrido con iteradores incompleto en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        cronometro.reiniciar();
+        ListaSensor<int>* copia = new ListaSensor<int>(lista);
+        const double segundosCopia = cronometro.segundos();
+        if (copia->getTamanio() != cantidad) {
+            std::cerr << "[ERROR] Copia incompleta en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        cronometro.reiniciar();
+        const int pares = copia->eliminarSi([](int dato) { return dato % 2 == 0; });
+        const double segundosEliminarSi = cronometro.segundos();
+        if (pares != (cantidad + 1) / 2 || copia->getTamanio() != cantidad - pares ||
+            copia->getCabeza()->dato != 1) {
+            std::cerr << "[ERROR] eliminarSi incorrecto en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        const int restantes = copia->getTamanio();
+        cronometro.reiniciar();
+        while (copia->eliminarPrimero()) {
+        }
+        const double segundosEliminarPrimero = cronometro.segundos();
+        if (!copia->estaVacia() || copia->getTamanio() != 0) {
+            std::cerr << "[ERROR] eliminarPrimero incompleto en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        delete copia;
+        
+        cronometro.reiniciar();
+        lista.vaciar();
+        const double segundosVaciado = cronometro.segundos();
+        if (!lista.estaVacia() || lista.getTamanio() != 0) {
+            std::cerr << "[ERROR] Vaciado incompleto en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        resultados.registrar("lista", casos[caso], "insertarAlFinal",
+                             segundosInsercion * 1e9 / cantidad, "ns/elemento");
+        resultados.registrar("lista", casos[caso], "insertarRango",
+                             segundosRango * 1e9 / cantidad, "ns/elemento");
+        resultados.registrar("lista", casos[caso], "empalmar",
+                             segundosEmpalme * 1e9, "ns/operacion");
+        resultados.registrar("lista", casos[caso], "dividir_mitad",
+                             segundosDivision * 1e9 / cantidad, "ns/elemento");
+        resultados.registrar("lista", casos[caso], "buscar",
+                             segundosBusqueda * 1e9 / busquedas, "ns/busqueda");
+        resultados.registrar("lista", casos[caso], "iterar",
+                             segundosRecorrido * 1e9 / (static_cast<double>(cantidad) * recorridos), "ns/elemento");
+        resultados.registrar("lista", casos[caso], "for_por_rango",
+                             segundosIterador * 1e9 / (static_cast<double>(cantidad) * recorridos), "ns/elemento");
+        resultados.registrar("lista", casos[caso], "copia",
+                             segundosCopia * 1e9 / cantidad, "ns/elemento");
+        resultados.registrar("lista", casos[caso], "eliminarSi_pares",
+                             segundosEliminarSi * 1e9 / cantidad, "ns/elemento");
+        resultados.registrar("lista", casos[caso], "eliminarPrimero",
+                             segundosEliminarPrimero * 1e9 / restantes, "ns/elemento");
+        resultados.registrar("lista", casos[caso], "vaciar",
+                             segundosVaciado * 1e9 / cantidad, "ns/elemento");
+    }
+    
+    medirPoliticasBusqueda(resultados);
+    medirCopiaTrivial(resultados);
+}
+
+#endif // BENCHLISTA_H
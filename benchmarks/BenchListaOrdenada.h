@@ -0,0 +1,121 @@
+/**
+ * @file BenchListaOrdenada.h
+ * @brief Pruebas de rendimiento de la lista ordenada por niveles
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHLISTAORDENADA_H
+#define BENCHLISTAORDENADA_H
+
+#include "Benchmark.h"
+#include "ListaOrdenada.h"
+#include "ListaSensor.h"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Compara ListaOrdenada con el recorrido lineal de ListaSensor
+ * @param resultados Acumulador de metricas
+ * 
+ * Para cada tamanio se mide la insercion en orden, la busqueda de claves
+ * presentes y el conteo de un rango de valores, que es la consulta de un
+ * historial por intervalo de medicion. La busqueda lineal solo se mide
+ * con una muestra de claves porque su costo crece con la lista.
+ */
+inline void ejecutarBenchListaOrdenada(ResultadosBenchmark& resultados) {
+    const int tamanios[] = { 1000, 10000, 100000 };
+    const char* casos[] = { "1k", "10k", "100k" };
+    
+    for (int caso = 0; caso < 3; caso++) {
+        const int cantidad = tamanios[caso];
+        std::mt19937 generador(47 + caso);
+        std::normal_distribution<float> medicion(22.5f, 4.0f);
+        std::vector<float> valores(static_cast<std::size_t>(cantidad));
+        for (int i = 0; i < cantidad; i++) {
+            valores[static_cast<std::size_t>(i)] = medicion(generador);
+        }
+        
+        ListaOrdenada<float> ordenada;
+        Cronometro cronometro;
+        for (int i = 0; i < cantidad; i++) {
+            ordenada.insertar(valores[static_cast<std::size_t>(i)]);
+        }
+        const double segundosInsercion = cronometro.segundos();
+        
+        ListaSensor<float> lineal;
+        lineal.insertarBloque(valores.data(), cantidad);
+        
+        float anterior = -1.0e30f;
+        bool enOrden = true;
+        ordenada.iterar([&anterior, &enOrden](float valor) {
+            enOrden = enOrden && !(valor < anterior);
+            anterior = valor;
+        });
+        if (!enOrden || ordenada.getTamanio() != cantidad) {
+            std::cerr << "[ERROR] ListaOrdenada desordenada en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        std::uniform_int_distribution<int> posicion(0, cantidad - 1);
+        const int consultas = 100000;
+        int encontrados = 0;
+        cronometro.reiniciar();
+        for (int i = 0; i < consultas; i++) {
+            encontrados += ordenada.buscar(valores[static_cast<std::size_t>(posicion(generador))]) != nullptr ? 1 : 0;
+        }
+        const double segundosBusqueda = cronometro.segundos();
+        
+        const int muestra = 1000;
+        int encontradosLineal = 0;
+        cronometro.reiniciar();
+        for (int i = 0; i < muestra; i++) {
+            const float buscado = valores[static_cast<std::size_t>(posicion(generador))];
+            encontradosLineal += lineal.buscarSi([buscado](float valor) { return valor == buscado; }) != nullptr ? 1 : 0;
+        }
+        const double segundosLineal = cronometro.segundos();
+        if (encontrados != consultas || encontradosLineal != muestra) {
+            std::cerr << "[ERROR] ListaOrdenada no encontro claves presentes en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        // Mediciones entre 20 y 21 grados
+        const int repeticiones = 1000;
+        long long enRango = 0;
+        cronometro.reiniciar();
+        for (int r = 0; r < repeticiones; r++) {
+            enRango += ordenada.iterarRango(20.0f, 21.0f, [](float) {});
+        }
+        const double segundosRango = cronometro.segundos();
+        long long enRangoLineal = 0;
+        cronometro.reiniciar();
+        for (int r = 0; r < repeticiones / 10; r++) {
+            lineal.iterar([&enRangoLineal](float valor) {
+                enRangoLineal += (valor >= 20.0f && valor < 21.0f) ? 1 : 0;
+            });
+        }
+        const double segundosRangoLineal = cronometro.segundos();
+        if (enRango / repeticiones != enRangoLineal / (repeticiones / 10)) {
+            std::cerr << "[ERROR] ListaOrdenada conto mal el rango en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        resultados.registrar("ListaOrdenada", casos[caso], "insertar",
+                             segundosInsercion * 1e9 / cantidad, "ns/elem");
+        resultados.registrar("ListaOrdenada", casos[caso], "buscar",
+                             segundosBusqueda * 1e9 / consultas, "ns/consulta");
+        resultados.registrar("ListaOrdenada", casos[caso], "buscar_lineal",
+                             segundosLineal * 1e9 / muestra, "ns/consulta");
+        resultados.registrar("ListaOrdenada", casos[caso], "rango",
+                             segundosRango * 1e9 / repeticiones, "ns/consulta");
+        resultados.registrar("ListaOrdenada", casos[caso], "rango_lineal",
+                             segundosRangoLineal * 1e9 / (repeticiones / 10), "ns/consulta");
+        resultados.registrar("ListaOrdenada", casos[caso], "niveles",
+                             ordenada.getNivelesActivos(), "niveles");
+    }
+}
+
+#endif // BENCHLISTAORDENADA_H
@@ -0,0 +1,183 @@
+/**
+ * @file BenchRegistro.h
+ * @brief Comparacion del registro polimorfico con el registro contiguo por tipo
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHREGISTRO_H
+#define BENCHREGISTRO_H
+
+#include "Benchmark.h"
+#include "ColeccionSensores.h"
+#include "RegistroPorTipo.h"
+#include "RegistroSensores.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Visitante que acumula mediciones y medias moviles por tipo concreto
+ */
+struct AcumuladorAnalisis {
+    long long mediciones;  ///< Total de mediciones recorridas
+    double medias;         ///< Suma de las medias de la ventana de 1 minuto
+    MarcaTiempo ahora;     ///< Instante de consulta de las ventanas
+    
+    explicit AcumuladorAnalisis(MarcaTiempo instante) : mediciones(0), medias(0.0), ahora(instante) {}
+    
+    void operator()(SensorTemperatura& sensor) {
+        mediciones += sensor.getCantidadMediciones();
+        medias += sensor.consultarVentana(0, ahora).media();
+    }
+    
+    void operator()(SensorPresion& sensor) {
+        mediciones += sensor.getCantidadMediciones();
+        medias += sensor.consultarVentana(0, ahora).media();
+    }
+};
+
+/**
+ * @brief Mide la baja de 100000 sensores con RegistroSensores::vaciar
+ * @param resultados Acumulador de metricas
+ * 
+ * La referencia libera como lo hacia el cierre del programa: un recorrido
+ * con delete por sensor seguido del vaciado de la coleccion.
+ * RegistroSensores::vaciar libera cada sensor en el mismo recorrido que
+ * devuelve su nodo. Cada sensor guarda 4 mediciones.
+ */
+inline void medirBajaRegistro(ResultadosBenchmark& resultados) {
+    const int sensores = 100000;
+    const int lecturasPorSensor = 4;
+    std::vector<std::string> nombres;
+    nombres.reserve(sensores);
+    for (int s = 0; s < sensores; s++) {
+        nombres.push_back((s % 2 == 0 ? "BT-" : "BP-") + std::to_string(s));
+    }
+    
+    ColeccionSensores individual;
+    RegistroSensores registro;
+    for (int s = 0; s < sensores; s++) {
+        const char* nombre = nombres[static_cast<std::size_t>(s)].c_str();
+        if (s % 2 == 0) {
+            SensorTemperatura* termico = new SensorTemperatura(nombre);
+            SensorTemperatura* registrado = registro.agregarTermico(nombre);
+            for (int i = 0; i < lecturasPorSensor; i++) {
+                termico->agregarLectura(20.0f + i, i * 1000);
+                registrado->agregarLectura(20.0f + i, i * 1000);
+            }
+            individual.insertarAlFinal(termico);
+        } else {
+            SensorPresion* presion = new SensorPresion(nombre);
+            SensorPresion* registrado = registro.agregarPresion(nombre);
+            for (int i = 0; i < lecturasPorSensor; i++) {
+                presion->agregarLectura(101300 + i, i * 1000);
+                registrado->agregarLectura(101300 + i, i * 1000);
+            }
+            individual.insertarAlFinal(presion);
+        }
+    }
+    
+    Cronometro cronometro;
+    individual.iterar([](SensorBase* dispositivo) {
+        delete dispositivo;
+    });
+    individual.vaciar();
+    const double segundosIndividual = cronometro.segundos();
+    
+    cronometro.reiniciar();
+    registro.vaciar();
+    const double segundosRegistro = cronometro.segundos();
+    if (!registro.estaVacio()) {
+        std::cerr << "[ERROR] RegistroSensores conserva sensores tras vaciar" << std::endl;
+        std::exit(1);
+    }
+    
+    resultados.registrar("registro", "baja_100000_sensores", "baja_individual",
+                         segundosIndividual * 1e9 / sensores, "ns/sensor");
+    resultados.registrar("registro", "baja_100000_sensores", "baja_registro",
+                         segundosRegistro * 1e9 / sensores, "ns/sensor");
+}
+
+/**
+ * @brief Mide un barrido de analisis sobre ambos registros
+ * @param resultados Acumulador de metricas
+ * 
+ * 10000 sensores (mitad de cada tipo) con 8 mediciones cada uno. Cada
+ * barrido suma las mediciones y la media de la ventana de 1 minuto de
+ * todos los sensores; se repite para promediar.
+ */
+inline void ejecutarBenchRegistro(ResultadosBenchmark& resultados) {
+    const int sensores = 10000;
+    const int lecturasPorSensor = 8;
+    const int barridos = 200;
+    
+    ColeccionSensores polimorfico;
+    RegistroPorTipo contiguo;
+    contiguo.reservar(sensores / 2, sensores / 2);
+    for (int s = 0; s < sensores; s++) {
+        const std::string nombre = (s % 2 == 0 ? "T-" : "P-") + std::to_string(s);
+        SensorBase* disperso = nullptr;
+        if (s % 2 == 0) {
+            SensorTemperatura* termico = new SensorTemperatura(nombre.c_str());
+            SensorTemperatura& local = contiguo.agregarTermico(nombre.c_str());
+            for (int i = 0; i < lecturasPorSensor; i++) {
+                termico->agregarLectura(20.0f + i, i * 1000);
+                local.agregarLectura(20.0f + i, i * 1000);
+            }
+            disperso = termico;
+        } else {
+            SensorPresion* presion = new SensorPresion(nombre.c_str());
+            SensorPresion& local = contiguo.agregarPresion(nombre.c_str());
+            for (int i = 0; i < lecturasPorSensor; i++) {
+                presion->agregarLectura(101300 + i, i * 1000);
+                local.agregarLectura(101300 + i, i * 1000);
+            }
+            disperso = presion;
+        }
+        polimorfico.insertarAlFinal(disperso);
+    }
+    const MarcaTiempo ahora = lecturasPorSensor * 1000;
+    
+    long long medicionesPolimorfico = 0;
+    double mediasPolimorfico = 0.0;
+    Cronometro cronometro;
+    for (int b = 0; b < barridos; b++) {
+        polimorfico.iterar([&medicionesPolimorfico, &mediasPolimorfico, ahora](SensorBase* dispositivo) {
+            medicionesPolimorfico += dispositivo->getCantidadMediciones();
+            mediasPolimorfico += dispositivo->consultarVentana(0, ahora).media();
+        });
+    }
+    const double segundosPolimorfico = cronometro.segundos();
+    
+    AcumuladorAnalisis acumulador(ahora);
+    cronometro.reiniciar();
+    for (int b = 0; b < barridos; b++) {
+        contiguo.visitar(acumulador);
+    }
+    const double segundosContiguo = cronometro.segundos();
+    
+    if (acumulador.mediciones != medicionesPolimorfico || acumulador.medias != mediasPolimorfico) {
+        std::cerr << "[ERROR] Los registros no producen el mismo analisis" << std::endl;
+        std::exit(1);
+    }
+    conservarResultado(acumulador);
+    
+    const double visitas = static_cast<double>(sensores) * barridos;
+    resultados.registrar("registro", "barrido_10000_sensores", "polimorfico_lista",
+                         segundosPolimorfico * 1e9 / visitas, "ns/sensor");
+    resultados.registrar("registro", "barrido_10000_sensores", "contiguo_por_tipo",
+                         segundosContiguo * 1e9 / visitas, "ns/sensor");
+    resultados.registrar("registro", "barrido_10000_sensores", "aceleracion",
+                         segundosPolimorfico / segundosContiguo, "x");
+    
+    polimorfico.iterar([](SensorBase* dispositivo) {
+        delete dispositivo;
+    });
+    
+    medirBajaRegistro(resultados);
+}
+
+#endif // BENCHREGISTRO_H
@@ -0,0 +1,148 @@
+/**
+ * @file BenchSensores.h
+ * @brief Pruebas de rendimiento del analisis de cada tipo de sensor
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHSENSORES_H
+#define BENCHSENSORES_H
+
+#include "Benchmark.h"
+#include "SensorPresion.h"
+#include "SensorTemperatura.h"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Compara la ingesta de a una medicion con agregarLecturas por tramas de 1000
+ * @param resultados Acumulador de metricas
+ * 
+ * Cada trama trae 1000 mediciones de un mismo sensor separadas por 1 ms,
+ * como una trama binaria o una reproduccion. Ambos caminos deben dejar
+ * la misma cantidad de mediciones y el mismo minimo en la ventana de 1
+ * minuto.
+ */
+inline void medirIngestaPorLotes(ResultadosBenchmark& resultados) {
+    const int porTrama = 1000;
+    const int tramas = 200;
+    std::mt19937 generador(67);
+    std::normal_distribution<float> temperatura(22.5f, 2.0f);
+    std::normal_distribution<float> presion(101325.0f, 300.0f);
+    std::vector<float> termicas(static_cast<std::size_t>(porTrama) * tramas);
+    std::vector<int> presiones(termicas.size());
+    std::vector<MarcaTiempo> marcas(termicas.size());
+    for (std::size_t i = 0; i < termicas.size(); i++) {
+        termicas[i] = temperatura(generador);
+        presiones[i] = static_cast<int>(presion(generador));
+        marcas[i] = static_cast<MarcaTiempo>(i);
+    }
+    const int total = static_cast<int>(termicas.size());
+    
+    SensorTemperatura termicoIndividual("BENCH-T1");
+    SensorTemperatura termicoLotes("BENCH-T2");
+    SensorPresion presionIndividual("BENCH-P1");
+    SensorPresion presionLotes("BENCH-P2");
+    Cronometro cronometro;
+    for (int i = 0; i < total; i++) {
+        termicoIndividual.agregarLectura(termicas[static_cast<std::size_t>(i)], marcas[static_cast<std::size_t>(i)]);
+    }
+    const double segundosTermicoIndividual = cronometro.segundos();
+    cronometro.reiniciar();
+    for (int t = 0; t < total; t += porTrama) {
+        termicoLotes.agregarLecturas(&termicas[static_cast<std::size_t>(t)], &marcas[static_cast<std::size_t>(t)], porTrama);
+    }
+    const double segundosTermicoLotes = cronometro.segundos();
+    cronometro.reiniciar();
+    for (int i = 0; i < total; i++) {
+        presionIndividual.agregarLectura(presiones[static_cast<std::size_t>(i)], marcas[static_cast<std::size_t>(i)]);
+    }
+    const double segundosPresionIndividual = cronometro.segundos();
+    cronometro.reiniciar();
+    for (int t = 0; t < total; t += porTrama) {
+        presionLotes.agregarLecturas(&presiones[static_cast<std::size_t>(t)], &marcas[static_cast<std::size_t>(t)], porTrama);
+    }
+    const double segundosPresionLotes = cronometro.segundos();
+    
+    const MarcaTiempo ahora = marcas.back();
+    if (termicoLotes.getCantidadMediciones() != total || presionLotes.getCantidadMediciones() != total ||
+        termicoLotes.consultarVentana(0, ahora).minimo != termicoIndividual.consultarVentana(0, ahora).minimo ||
+        presionLotes.consultarVentana(0, ahora).minimo != presionIndividual.consultarVentana(0, ahora).minimo) {
+        std::cerr << "[ERROR] agregarLecturas no coincide con la ingesta individual" << std::endl;
+        std::exit(1);
+    }
+    
+    resultados.registrar("sensores", "tramas_1000", "temperatura_individual",
+                         segundosTermicoIndividual * 1e9 / total, "ns/medicion");
+    resultados.registrar("sensores", "tramas_1000", "temperatura_lotes",
+                         segundosTermicoLotes * 1e9 / total, "ns/medicion");
+    resultados.registrar("sensores", "tramas_1000", "presion_individual",
+                         segundosPresionIndividual * 1e9 / total, "ns/medicion");
+    resultados.registrar("sensores", "tramas_1000", "presion_lotes",
+                         segundosPresionLotes * 1e9 / total, "ns/medicion");
+}
+
+/**
+ * @brief Mide procesarLectura de ambos tipos de sensor para varios tamanios de historial
+ * @param resultados Acumulador de metricas
+ * 
+ * El historial abarca el tramo compactado y el reciente, con la
+ * configuracion predeterminada de cada sensor. La linea que procesarLectura
+ * escribe en consola se formatea pero se descarta. Ambos sensores toman
+ * del archivo solo las cabeceras de bloque, de modo que el costo se
+ * informa por llamada y no por medicion almacenada.
+ */
+inline void ejecutarBenchSensores(ResultadosBenchmark& resultados) {
+    const int tamanios[] = { 1000, 10000, 100000, 1000000 };
+    const char* sufijos[] = { "1k", "10k", "100k", "1M" };
+    
+    for (int caso = 0; caso < 4; caso++) {
+        const int cantidad = tamanios[caso];
+        const int repeticiones = 10000;
+        std::mt19937 generador(61 + caso);
+        std::normal_distribution<float> temperatura(22.5f, 2.0f);
+        std::normal_distribution<float> presion(101325.0f, 300.0f);
+        
+        SensorTemperatura termico("BENCH-T");
+        SensorPresion barometrico("BENCH-P");
+        for (int i = 0; i < cantidad; i++) {
+            const MarcaTiempo marca = static_cast<MarcaTiempo>(i) * 1000;
+            termico.agregarLectura(temperatura(generador), marca);
+            barometrico.agregarLectura(static_cast<int>(presion(generador)), marca);
+        }
+        if (termico.getCantidadMediciones() != cantidad || barometrico.getCantidadMediciones() != cantidad) {
+            std::cerr << "[ERROR] Historial incompleto en sensores_" << sufijos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        double segundosTermico = 0.0;
+        double segundosPresion = 0.0;
+        {
+            SilencioConsola silencio;
+            Cronometro cronometro;
+            for (int r = 0; r < repeticiones; r++) {
+                termico.procesarLectura();
+            }
+            segundosTermico = cronometro.segundos();
+            
+            cronometro.reiniciar();
+            for (int r = 0; r < repeticiones; r++) {
+                barometrico.procesarLectura();
+            }
+            segundosPresion = cronometro.segundos();
+        }
+        
+        resultados.registrar("sensores", std::string("temperatura_") + sufijos[caso], "procesarLectura",
+                             segundosTermico * 1e9 / repeticiones, "ns/llamada");
+        resultados.registrar("sensores", std::string("presion_") + sufijos[caso], "procesarLectura",
+                             segundosPresion * 1e9 / repeticiones, "ns/llamada");
+    }
+    
+    medirIngestaPorLotes(resultados);
+}
+
+#endif // BENCHSENSORES_H
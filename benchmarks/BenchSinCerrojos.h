@@ -0,0 +1,214 @@
+/**
+ * @file BenchSinCerrojos.h
+ * @brief Prueba de estres y rendimiento del registro con varios hilos de ingesta
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHSINCERROJOS_H
+#define BENCHSINCERROJOS_H
+
+#include "Benchmark.h"
+#include "ListaSensor.h"
+#include "ListaSinCerrojos.h"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Elemento del registro protegido por cerrojo usado como referencia
+ */
+struct EntradaRegistro {
+    unsigned long long clave;  ///< Identificador del sensor
+    int valor;                 ///< Dato asociado
+};
+
+/**
+ * @brief Termina las pruebas si la lista no quedo en el estado esperado
+ */
+inline void verificarSinCerrojos(bool condicion, const char* etapa) {
+    if (!condicion) {
+        std::cerr << "[ERROR] ListaSinCerrojos inconsistente tras " << etapa << std::endl;
+        std::exit(1);
+    }
+}
+
+/**
+ * @brief Cuenta las claves de la lista y verifica que esten en orden estricto
+ * @return Cantidad de claves, o -1 si el orden no es estricto
+ */
+inline int contarOrdenado(const ListaSinCerrojos<int>& lista) {
+    long long anterior = -1;
+    bool ordenada = true;
+    const int visitados = lista.iterar([&anterior, &ordenada](unsigned long long clave, const int& valor) {
+        if (static_cast<long long>(clave) <= anterior || static_cast<unsigned long long>(valor) != clave) {
+            ordenada = false;
+        }
+        anterior = static_cast<long long>(clave);
+    });
+    return ordenada ? visitados : -1;
+}
+
+/**
+ * @brief Ejecuta una funcion en varios hilos y suma sus resultados
+ * @tparam Tarea Invocable con firma long long(int hilo)
+ */
+template <typename Tarea>
+long long ejecutarEnHilos(int hilos, Tarea tarea) {
+    std::vector<long long> parciales(static_cast<std::size_t>(hilos), 0);
+    std::vector<std::thread> trabajadores;
+    for (int h = 0; h < hilos; h++) {
+        trabajadores.push_back(std::thread([&parciales, &tarea, h]() {
+            parciales[static_cast<std::size_t>(h)] = tarea(h);
+        }));
+    }
+    long long total = 0;
+    for (int h = 0; h < hilos; h++) {
+        trabajadores[static_cast<std::size_t>(h)].join();
+        total += parciales[static_cast<std::size_t>(h)];
+    }
+    return total;
+}
+
+/**
+ * @brief Somete la lista a inserciones, retiros y busquedas simultaneas
+ * 
+ * Verifica que cada clave se registre una sola vez aunque todos los hilos
+ * la inserten, que cada retiro tenga un unico ganador y que, tras una
+ * rafaga aleatoria, el tamanio coincida con el balance de operaciones.
+ */
+inline void estresarSinCerrojos() {
+    const int hilos = 8;
+    const int claves = 2000;
+    ListaSinCerrojos<int> lista;
+    
+    const long long insertadas = ejecutarEnHilos(hilos, [&lista](int h) {
+        long long propias = 0;
+        for (int i = 0; i < claves; i++) {
+            const int clave = (i + h * (claves / hilos)) % claves;
+            propias += lista.insertar(static_cast<unsigned long long>(clave), clave) ? 1 : 0;
+        }
+        return propias;
+    });
+    verificarSinCerrojos(insertadas == claves && lista.getTamanio() == claves &&
+                         contarOrdenado(lista) == claves, "inserciones repetidas");
+    
+    const long long retiradas = ejecutarEnHilos(hilos, [&lista](int h) {
+        std::mt19937 generador(static_cast<unsigned>(h) + 1u);
+        std::uniform_int_distribution<int> azar(0, claves - 1);
+        long long propias = 0;
+        for (int i = 0; i < claves; i++) {
+            int valor = 0;
+            const int consultada = azar(generador);
+            if (lista.buscar(static_cast<unsigned long long>(consultada), valor) && valor != consultada) {
+                return -1000000LL;
+            }
+            propias += lista.eliminar(static_cast<unsigned long long>((i + h) % claves)) ? 1 : 0;
+        }
+        return propias;
+    });
+    verificarSinCerrojos(retiradas == claves && lista.getTamanio() == 0 &&
+                         contarOrdenado(lista) == 0, "retiros concurrentes");
+    
+    const long long balance = ejecutarEnHilos(hilos, [&lista](int h) {
+        std::mt19937 generador(static_cast<unsigned>(h) + 100u);
+        std::uniform_int_distribution<int> azar(0, 255);
+        long long propio = 0;
+        for (int i = 0; i < 50000; i++) {
+            const int clave = azar(generador);
+            if (i % 2 == 0) {
+                propio += lista.insertar(static_cast<unsigned long long>(clave), clave) ? 1 : 0;
+            } else {
+                propio -= lista.eliminar(static_cast<unsigned long long>(clave)) ? 1 : 0;
+            }
+        }
+        return propio;
+    });
+    verificarSinCerrojos(balance == lista.getTamanio() && contarOrdenado(lista) == balance,
+                         "rafaga aleatoria");
+}
+
+/**
+ * @brief Compara el registro sin cerrojos con una ListaSensor protegida por mutex
+ * @param resultados Acumulador de metricas
+ * 
+ * Cada hilo simula una ingesta: busca el sensor de cada linea, lo registra
+ * si no existe y, ocasionalmente, retira uno. La flota es de 1024 sensores
+ * y el total de operaciones se reparte entre los hilos, de modo que el
+ * tiempo refleja la escalabilidad y no el volumen de trabajo.
+ */
+inline void ejecutarBenchSinCerrojos(ResultadosBenchmark& resultados) {
+    estresarSinCerrojos();
+    
+    const int sensores = 1024;
+    const int operaciones = 400000;
+    for (int hilos = 1; hilos <= 32; hilos *= 2) {
+        const int porHilo = operaciones / hilos;
+        std::ostringstream caso;
+        caso << hilos << "_hilos";
+        
+        ListaSinCerrojos<int> libre;
+        Cronometro cronometro;
+        const long long encontradosLibre = ejecutarEnHilos(hilos, [&libre, porHilo](int h) {
+            std::mt19937 generador(static_cast<unsigned>(h) + 7u);
+            std::uniform_int_distribution<int> azar(0, sensores - 1);
+            long long encontrados = 0;
+            for (int i = 0; i < porHilo; i++) {
+                const int clave = azar(generador);
+                int valor = 0;
+                if (i % 100 == 99) {
+                    libre.eliminar(static_cast<unsigned long long>(clave));
+                } else if (libre.buscar(static_cast<unsigned long long>(clave), valor)) {
+                    encontrados++;
+                } else {
+                    libre.insertar(static_cast<unsigned long long>(clave), clave);
+                }
+            }
+            return encontrados;
+        });
+        const double segundosLibre = cronometro.segundos();
+        conservarResultado(encontradosLibre);
+        verificarSinCerrojos(contarOrdenado(libre) == libre.getTamanio(), "la ingesta simulada");
+        
+        ListaSensor<EntradaRegistro> protegida;
+        std::mutex cerrojo;
+        cronometro.reiniciar();
+        const long long encontradosMutex = ejecutarEnHilos(hilos, [&protegida, &cerrojo, porHilo](int h) {
+            std::mt19937 generador(static_cast<unsigned>(h) + 7u);
+            std::uniform_int_distribution<int> azar(0, sensores - 1);
+            long long encontrados = 0;
+            for (int i = 0; i < porHilo; i++) {
+                const unsigned long long clave = static_cast<unsigned long long>(azar(generador));
+                std::lock_guard<std::mutex> guarda(cerrojo);
+                if (i % 100 == 99) {
+                    protegida.eliminarSi([clave](const EntradaRegistro& entrada) {
+                        return entrada.clave == clave;
+                    });
+                } else if (protegida.buscarSi([clave](const EntradaRegistro& entrada) {
+                               return entrada.clave == clave;
+                           }) != nullptr) {
+                    encontrados++;
+                } else {
+                    EntradaRegistro nueva;
+                    nueva.clave = clave;
+                    nueva.valor = static_cast<int>(clave);
+                    protegida.insertarAlFinal(nueva);
+                }
+            }
+            return encontrados;
+        });
+        const double segundosMutex = cronometro.segundos();
+        conservarResultado(encontradosMutex);
+        
+        resultados.registrar("ListaSinCerrojos", caso.str(), "sin_cerrojos", operaciones / segundosLibre, "ops/s");
+        resultados.registrar("ListaSinCerrojos", caso.str(), "mutex", operaciones / segundosMutex, "ops/s");
+    }
+}
+
+#endif // BENCHSINCERROJOS_H
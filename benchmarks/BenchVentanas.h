@@ -0,0 +1,82 @@
+/**
+ * @file BenchVentanas.h
+ * @brief Pruebas de rendimiento de las ventanas moviles
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHVENTANAS_H
+#define BENCHVENTANAS_H
+
+#include "Benchmark.h"
+#include "VentanasDeslizantes.h"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Mide actualizacion y consulta de una ventana de 15 minutos a distintas tasas
+ * @param resultados Acumulador de metricas
+ * 
+ * El costo por medicion debe mantenerse constante aunque la ventana
+ * contenga mas mediciones. Al final se compara la ventana con un
+ * recorrido directo de la serie.
+ */
+inline void ejecutarBenchVentanas(ResultadosBenchmark& resultados) {
+    const int cantidad = 2000000;
+    const MarcaTiempo duracion = 15 * 60 * 1000;
+    const int periodos[] = { 1000, 100, 1 };
+    const char* casos[] = { "ventana_15min_1Hz", "ventana_15min_10Hz", "ventana_15min_1kHz" };
+    
+    for (int caso = 0; caso < 3; caso++) {
+        std::mt19937 generador(4242 + caso);
+        std::normal_distribution<float> ruido(22.5f, 2.0f);
+        std::vector<MarcaTiempo> marcas(cantidad);
+        std::vector<float> valores(cantidad);
+        for (int i = 0; i < cantidad; i++) {
+            marcas[i] = static_cast<MarcaTiempo>(i) * periodos[caso];
+            valores[i] = ruido(generador);
+        }
+        
+        VentanasDeslizantes<float, 1> ventana(&duracion);
+        Cronometro cronometro;
+        for (int i = 0; i < cantidad; i++) {
+            ventana.agregar(marcas[i], valores[i]);
+        }
+        const double segundosActualizacion = cronometro.segundos();
+        
+        const int consultas = 1000000;
+        double acumulado = 0.0;
+        cronometro.reiniciar();
+        for (int i = 0; i < consultas; i++) {
+            conservarResultado(ventana);
+            acumulado += ventana.resumir(0).minimo;
+        }
+        const double segundosConsulta = cronometro.segundos();
+        conservarResultado(acumulado);
+        
+        ResumenRango esperado;
+        for (int i = 0; i < cantidad; i++) {
+            if (marcas[i] > marcas[cantidad - 1] - duracion) {
+                esperado.incorporar(valores[i]);
+            }
+        }
+        const ResumenRango obtenido = ventana.resumir(0);
+        if (obtenido.cantidad != esperado.cantidad || obtenido.minimo != esperado.minimo ||
+            obtenido.maximo != esperado.maximo) {
+            std::cerr << "[ERROR] La ventana no coincide con el recorrido directo en " << casos[caso] << std::endl;
+            std::exit(1);
+        }
+        
+        resultados.registrar("ventanas", casos[caso], "mediciones_en_ventana",
+                             static_cast<double>(obtenido.cantidad), "lecturas");
+        resultados.registrar("ventanas", casos[caso], "actualizacion",
+                             segundosActualizacion * 1e9 / cantidad, "ns/lectura");
+        resultados.registrar("ventanas", casos[caso], "consulta",
+                             segundosConsulta * 1e9 / consultas, "ns/consulta");
+    }
+}
+
+#endif // BENCHVENTANAS_H
@@ -0,0 +1,192 @@
+/**
+ * @file Benchmark.h
+ * @brief Utilidades comunes para las pruebas de rendimiento
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/**
+ * @class Cronometro
+ * @brief Medicion de intervalos con el reloj monotonico de alta resolucion
+ */
+class Cronometro {
+private:
+    std::chrono::steady_clock::time_point inicio;  ///< Instante de referencia
+    
+public:
+    Cronometro() : inicio(std::chrono::steady_clock::now()) {}
+    
+    /**
+     * @brief Reinicia el instante de referencia
+     */
+    void reiniciar() {
+        inicio = std::chrono::steady_clock::now();
+    }
+    
+    /**
+     * @brief Tiempo transcurrido desde el inicio
+     * @return Segundos transcurridos
+     */
+    double segundos() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    }
+};
+
+/**
+ * @brief Impide que el compilador elimine un calculo cuyo resultado no se usa
+ * @param valor Resultado a conservar
+ */
+template <typename V>
+void conservarResultado(const V& valor) {
+    asm volatile("" : : "g"(&valor) : "memory");
+}
+
+/**
+ * @class SilencioConsola
+ * @brief Descarta lo escrito en std::cout durante el alcance del objeto
+ * 
+ * Algunas operaciones medidas informan su resultado por consola. El
+ * formateo se sigue ejecutando y midiendo; solo se descarta la escritura.
+ */
+class SilencioConsola {
+private:
+    /// Buffer que reutiliza un arreglo fijo y nunca entrega los datos
+    class BufferDescarte : public std::streambuf {
+    private:
+        char bloque[256];
+        
+    protected:
+        int overflow(int caracter) override {
+            setp(bloque, bloque + sizeof(bloque));
+            return traits_type::not_eof(caracter);
+        }
+    };
+    
+    BufferDescarte descarte;     ///< Destino de la salida descartada
+    std::streambuf* anterior;    ///< Buffer original de std::cout
+    
+public:
+    SilencioConsola() : anterior(std::cout.rdbuf(&descarte)) {}
+    
+    ~SilencioConsola() {
+        std::cout.rdbuf(anterior);
+    }
+    
+    SilencioConsola(const SilencioConsola&) = delete;
+    SilencioConsola& operator=(const SilencioConsola&) = delete;
+};
+
+/**
+ * @struct ResultadoBenchmark
+ * @brief Una metrica medida por un caso de prueba
+ */
+struct ResultadoBenchmark {
+    std::string suite;    ///< Grupo de pruebas (por ejemplo "compresion")
+    std::string caso;     ///< Escenario medido dentro de la suite
+    std::string metrica;  ///< Nombre de la magnitud
+    double valor;         ///< Valor medido
+    std::string unidad;   ///< Unidad del valor
+};
+
+/**
+ * @class ResultadosBenchmark
+ * @brief Acumula las metricas de todas las suites y las presenta
+ */
+class ResultadosBenchmark {
+private:
+    std::vector<ResultadoBenchmark> resultados;  ///< Metricas en orden de registro
+    
+public:
+    /**
+     * @brief Registra una metrica
+     */
+    void registrar(const std::string& suite, const std::string& caso, const std::string& metrica,
+                   double valor, const std::string& unidad) {
+        ResultadoBenchmark resultado;
+        resultado.suite = suite;
+        resultado.caso = caso;
+        resultado.metrica = metrica;
+        resultado.valor = valor;
+        resultado.unidad = unidad;
+        resultados.push_back(resultado);
+    }
+    
+    /**
+     * @brief Imprime las metricas como tabla de texto
+     * @param salida Flujo de destino
+     */
+    void imprimirTabla(std::ostream& salida) const {
+        for (std::size_t i = 0; i < resultados.size(); i++) {
+            const ResultadoBenchmark& r = resultados[i];
+            salida << std::left << std::setw(14) << r.suite << std::setw(28) << r.caso
+                   << std::setw(24) << r.metrica << std::right << std::setw(14)
+                   << std::fixed << std::setprecision(3) << r.valor << " " << r.unidad << std::endl;
+        }
+    }
+    
+    /**
+     * @brief Imprime las metricas como documento JSON
+     * @param salida Flujo de destino
+     * 
+     * Produce un objeto con un arreglo "resultados"; cada elemento tiene los
+     * campos suite, caso, metrica, valor y unidad, para comparar ejecuciones
+     * con herramientas externas.
+     */
+    void imprimirJSON(std::ostream& salida) const {
+        salida << "{\n  \"resultados\": [";
+        for (std::size_t i = 0; i < resultados.size(); i++) {
+            const ResultadoBenchmark& r = resultados[i];
+            salida << (i == 0 ? "\n" : ",\n") << "    {\"suite\": ";
+            escribirCadenaJSON(salida, r.suite);
+            salida << ", \"caso\": ";
+            escribirCadenaJSON(salida, r.caso);
+            salida << ", \"metrica\": ";
+            escribirCadenaJSON(salida, r.metrica);
+            salida << ", \"valor\": ";
+            if (std::isfinite(r.valor)) {
+                salida << std::setprecision(12) << std::defaultfloat << r.valor;
+            } else {
+                salida << "null";
+            }
+            salida << ", \"unidad\": ";
+            escribirCadenaJSON(salida, r.unidad);
+            salida << "}";
+        }
+        salida << "\n  ]\n}" << std::endl;
+    }
+    
+private:
+    /**
+     * @brief Escribe una cadena JSON entre comillas, escapando caracteres especiales
+     */
+    static void escribirCadenaJSON(std::ostream& salida, const std::string& texto) {
+        salida << '"';
+        for (std::size_t i = 0; i < texto.size(); i++) {
+            const unsigned char c = static_cast<unsigned char>(texto[i]);
+            if (c == '"' || c == '\\') {
+                salida << '\\' << texto[i];
+            } else if (c < 0x20) {
+                const char* hex = "0123456789abcdef";
+                salida << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+            } else {
+                salida << texto[i];
+            }
+        }
+        salida << '"';
+    }
+};
+
+#endif // BENCHMARK_H
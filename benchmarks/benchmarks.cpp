@@ -0,0 +1,85 @@
+/**
+ * @file benchmarks.cpp
+ * @brief Programa de pruebas de rendimiento del sistema de sensores
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ * 
+ * Ejecuta las suites de rendimiento y presenta las metricas obtenidas.
+ * Los mensajes de traza de listas y sensores se desactivan durante
+ * la ejecucion para no medir la escritura en consola.
+ * 
+ * Uso: benchmarks [--json RUTA]
+ * Con --json, las metricas se escriben ademas como JSON en RUTA
+ * ("-" para la salida estandar en lugar de la tabla).
+ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "Bitacora.h"
+#include "Benchmark.h"
+#include "BenchCompresion.h"
+#include "BenchVentanas.h"
+#include "BenchCuantiles.h"
+#include "BenchAlertas.h"
+#include "BenchDespacho.h"
+#include "BenchRegistro.h"
+#include "BenchLista.h"
+#include "BenchListaOrdenada.h"
+#include "BenchSensores.h"
+#include "BenchIngesta.h"
+#include "BenchConcurrencia.h"
+#include "BenchSinCerrojos.h"
+
+/**
+ * @brief Punto de entrada de las pruebas de rendimiento
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos de la linea de comandos
+ * @return int Codigo de retorno (0 indica ejecucion exitosa)
+ */
+int main(int argc, char* argv[]) {
+    std::string rutaJSON;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            rutaJSON = argv[++i];
+        } else {
+            std::cerr << "[ERROR] Argumento no reconocido: " << argv[i] << std::endl;
+            std::cerr << "Uso: " << argv[0] << " [--json RUTA]" << std::endl;
+            return 1;
+        }
+    }
+    
+    Bitacora::activar(false);
+    ResultadosBenchmark resultados;
+    
+    ejecutarBenchCompresionGorilla(resultados);
+    ejecutarBenchEmpaquetadoPresion(resultados);
+    ejecutarBenchVentanas(resultados);
+    ejecutarBenchCuantiles(resultados);
+    ejecutarBenchAlertas(resultados);
+    ejecutarBenchDespacho(resultados);
+    ejecutarBenchRegistro(resultados);
+    ejecutarBenchLista(resultados);
+    ejecutarBenchListaOrdenada(resultados);
+    ejecutarBenchSensores(resultados);
+    ejecutarBenchIngesta(resultados);
+    ejecutarBenchConcurrencia(resultados);
+    ejecutarBenchSinCerrojos(resultados);
+    
+    if (rutaJSON == "-") {
+        resultados.imprimirJSON(std::cout);
+        return 0;
+    }
+    resultados.imprimirTabla(std::cout);
+    if (!rutaJSON.empty()) {
+        std::ofstream archivo(rutaJSON.c_str());
+        resultados.imprimirJSON(archivo);
+        if (!archivo) {
+            std::cerr << "[ERROR] No se pudo escribir " << rutaJSON << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,335 @@
+/**
+ * @file GeneradorCarga.h
+ * @brief Simulador de una flota de Arduinos sobre un pseudoterminal
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ */
+
+#ifndef GENERADORCARGA_H
+#define GENERADORCARGA_H
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <poll.h>
+#include <random>
+#include <sys/ioctl.h>
+#include <string>
+#include <termios.h>
+#include <thread>
+#include <unistd.h>
+
+/**
+ * @struct ConfiguracionCarga
+ * @brief Parametros de la carga sintetica
+ */
+struct ConfiguracionCarga {
+    int sensores;              ///< Sensores simulados
+    double fraccionPresion;    ///< Fraccion de sensores de presion (el resto son termicos)
+    double tasa;               ///< Lineas por segundo en regimen normal
+    double jitter;             ///< Variacion relativa del intervalo entre lineas (0 a 1)
+    int rafaga;                ///< Lineas adicionales emitidas de una vez en cada rafaga (0 = sin rafagas)
+    double periodoRafaga;      ///< Segundos entre rafagas
+    double fraccionMalformada; ///< Fraccion de lineas con formato invalido
+    double duracion;           ///< Segundos de emision (0 = hasta interrumpir)
+    unsigned semilla;          ///< Semilla del generador pseudoaleatorio
+    double retrasoMaximo;      ///< Segundos de atraso tras los cuales una linea se descarta
+    bool bloqueante;           ///< true: nunca descartar, emitir con atraso
+    
+    ConfiguracionCarga()
+        : sensores(10), fraccionPresion(0.5), tasa(100.0), jitter(0.0), rafaga(0),
+          periodoRafaga(1.0), fraccionMalformada(0.0), duracion(0.0), semilla(1),
+          retrasoMaximo(0.1), bloqueante(false) {}
+};
+
+/**
+ * @struct EstadisticasCarga
+ * @brief Contadores de una ejecucion del generador
+ */
+struct EstadisticasCarga {
+    unsigned long long enviadas;     ///< Lineas escritas completas
+    unsigned long long malformadas;  ///< Lineas invalidas entre las enviadas
+    unsigned long long descartadas;  ///< Lineas perdidas por atraso (modo no bloqueante)
+    unsigned long long bytes;        ///< Bytes escritos
+    
+    EstadisticasCarga() : enviadas(0), malformadas(0), descartadas(0), bytes(0) {}
+};
+
+/**
+ * @class GeneradorCarga
+ * @brief Emite lineas "T id valor" y "P id valor" por el lado maestro de un pty
+ * 
+ * El lado esclavo se comporta como el puerto de un Arduino: el programa
+ * principal lo abre con SerialPort sin modificaciones. Las lineas siguen
+ * un calendario con la tasa, el jitter y las rafagas configuradas; cuando
+ * el calendario se atrasa, las lineas vencidas se emiten juntas.
+ * 
+ * Cuando el lector no consume a tiempo, el buffer del pty se llena y la
+ * escritura espera. Las lineas cuyo turno vencio hace mas de retrasoMaximo
+ * se descartan y se contabilizan, como las mediciones que pierde un
+ * dispositivo con memoria acotada; en modo bloqueante se emiten con atraso.
+ * Una linea ya comenzada siempre se completa para no corromper el flujo.
+ */
+class GeneradorCarga {
+private:
+    ConfiguracionCarga configuracion;  ///< Parametros de la carga
+    EstadisticasCarga estadisticas;    ///< Contadores acumulados
+    int maestro;                       ///< Descriptor del lado maestro del pty
+    std::string rutaEsclavo;           ///< Ruta del lado esclavo (/dev/pts/N)
+    std::mt19937 generador;            ///< Fuente pseudoaleatoria reproducible
+    
+    /**
+     * @brief Segundos transcurridos desde un instante
+     */
+    static double segundosDesde(std::chrono::steady_clock::time_point inicio) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    }
+    
+    /**
+     * @brief Escribe una linea completa en el maestro, esperando si el pty esta lleno
+     * @return false si el lector cerro el puerto
+     */
+    bool escribirLinea(const std::string& linea) {
+        std::size_t escritos = 0;
+        while (escritos < linea.size()) {
+            const ssize_t resultado = write(maestro, linea.data() + escritos, linea.size() - escritos);
+            if (resultado > 0) {
+                escritos += static_cast<std::size_t>(resultado);
+                continue;
+            }
+            if (resultado < 0 && errno == EINTR) {
+                continue;
+            }
+            if (resultado < 0 && errno == EAGAIN) {
+                struct pollfd espera = { maestro, POLLOUT, 0 };
+                poll(&espera, 1, 100);
+                continue;
+            }
+            return false;
+        }
+        estadisticas.bytes += escritos;
+        return true;
+    }
+    
+    /**
+     * @brief Compone la siguiente linea de la carga
+     * @param malformada Se pone en true si la linea es intencionalmente invalida
+     */
+    std::string componerLinea(bool& malformada) {
+        std::uniform_int_distribution<int> elegido(0, configuracion.sensores - 1);
+        std::uniform_real_distribution<double> azar(0.0, 1.0);
+        const int sensor = elegido(generador);
+        const bool presion = sensor < static_cast<int>(configuracion.fraccionPresion * configuracion.sensores);
+        char linea[64];
+        
+        malformada = azar(generador) < configuracion.fraccionMalformada;
+        if (malformada) {
+            std::uniform_int_distribution<int> variante(0, 3);
+            switch (variante(generador)) {
+                case 0:
+                    std::snprintf(linea, sizeof(linea), "%c SIM-%d\n", presion ? 'P' : 'T', sensor);
+                    break;
+                case 1:
+                    std::snprintf(linea, sizeof(linea), "X SIM-%d 0\n", sensor);
+                    break;
+                case 2:
+                    std::snprintf(linea, sizeof(linea), "%c SIM-%d ##\n", presion ? 'P' : 'T', sensor);
+                    break;
+                default:
+                    std::snprintf(linea, sizeof(linea), "%c\n", presion ? 'P' : 'T');
+                    break;
+            }
+            return linea;
+        }
+        if (presion) {
+            std::normal_distribution<double> valor(101325.0 + 40.0 * sensor, 250.0);
+            std::snprintf(linea, sizeof(linea), "P SIM-%d %d\n", sensor, static_cast<int>(valor(generador)));
+        } else {
+            std::normal_distribution<double> valor(21.0 + 0.1 * sensor, 1.5);
+            std::snprintf(linea, sizeof(linea), "T SIM-%d %.1f\n", sensor, valor(generador));
+        }
+        return linea;
+    }
+    
+    /**
+     * @brief Emite una linea y actualiza los contadores
+     * @param retraso Segundos transcurridos desde el turno de la linea
+     * @return false si el lector cerro el puerto
+     * 
+     * La linea se compone aunque se descarte, para que la secuencia
+     * pseudoaleatoria no dependa de la velocidad del lector.
+     */
+    bool emitir(double retraso) {
+        bool malformada = false;
+        const std::string linea = componerLinea(malformada);
+        if (!configuracion.bloqueante && retraso > configuracion.retrasoMaximo) {
+            estadisticas.descartadas++;
+            return true;
+        }
+        if (!escribirLinea(linea)) {
+            return false;
+        }
+        estadisticas.enviadas++;
+        estadisticas.malformadas += malformada;
+        return true;
+    }
+    
+public:
+    /**
+     * @brief Constructor
+     * @param parametros Configuracion de la carga
+     */
+    explicit GeneradorCarga(const ConfiguracionCarga& parametros)
+        : configuracion(parametros), maestro(-1), generador(parametros.semilla) {}
+    
+    GeneradorCarga(const GeneradorCarga&) = delete;
+    GeneradorCarga& operator=(const GeneradorCarga&) = delete;
+    
+    ~GeneradorCarga() {
+        if (maestro >= 0) {
+            close(maestro);
+        }
+    }
+    
+    /**
+     * @brief Crea el par de pseudoterminales en modo sin procesar
+     * @return true si el pty quedo listo para que un lector abra el lado esclavo
+     */
+    bool abrir() {
+        maestro = posix_openpt(O_RDWR | O_NOCTTY);
+        if (maestro < 0 || grantpt(maestro) != 0 || unlockpt(maestro) != 0) {
+            std::cerr << "[ERROR] No se pudo crear el pseudoterminal: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+        rutaEsclavo = ptsname(maestro);
+        
+        // Abrir y cerrar el esclavo deja el modo sin procesar configurado y
+        // marca el maestro con POLLHUP hasta que un lector lo abra
+        const int esclavo = open(rutaEsclavo.c_str(), O_RDWR | O_NOCTTY);
+        if (esclavo < 0) {
+            std::cerr << "[ERROR] No se pudo abrir " << rutaEsclavo << ": " << std::strerror(errno) << std::endl;
+            return false;
+        }
+        struct termios modo;
+        tcgetattr(esclavo, &modo);
+        cfmakeraw(&modo);
+        tcsetattr(esclavo, TCSANOW, &modo);
+        close(esclavo);
+        
+        fcntl(maestro, F_SETFL, fcntl(maestro, F_GETFL) | O_NONBLOCK);
+        return true;
+    }
+    
+    /**
+     * @brief Espera a que un lector abra el lado esclavo
+     * @param detener Indicador de interrupcion
+     * @return true si hay un lector conectado
+     */
+    bool esperarLector(const std::atomic<bool>& detener) const {
+        while (!detener.load()) {
+            struct pollfd estado = { maestro, POLLOUT, 0 };
+            poll(&estado, 1, 0);
+            if (!(estado.revents & POLLHUP)) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        return false;
+    }
+    
+    /**
+     * @brief Emite la carga hasta cumplir la duracion o recibir la interrupcion
+     * @param detener Indicador de interrupcion (por ejemplo, desde SIGINT)
+     * @param informe Funcion invocada cada segundo con el tiempo transcurrido y los contadores
+     * @return false si el lector cerro el puerto antes de terminar
+     */
+    template <typename Informe>
+    bool ejecutar(const std::atomic<bool>& detener, Informe informe) {
+        const std::chrono::steady_clock::time_point inicio = std::chrono::steady_clock::now();
+        const double intervalo = 1.0 / configuracion.tasa;
+        std::uniform_real_distribution<double> variacion(-configuracion.jitter, configuracion.jitter);
+        double proximaLinea = 0.0;
+        double proximaRafaga = configuracion.periodoRafaga;
+        double proximoInforme = 1.0;
+        
+        while (!detener.load()) {
+            const double corte = segundosDesde(inicio);
+            if (configuracion.duracion > 0.0 && corte >= configuracion.duracion) {
+                break;
+            }
+            // Solo las lineas vencidas al entrar, para no postergar el informe
+            // ni la duracion mientras el lector este saturado
+            while (proximaLinea <= corte) {
+                if (!emitir(segundosDesde(inicio) - proximaLinea)) {
+                    return false;
+                }
+                proximaLinea += intervalo * (1.0 + variacion(generador));
+            }
+            if (configuracion.rafaga > 0 && proximaRafaga <= corte) {
+                for (int i = 0; i < configuracion.rafaga; i++) {
+                    if (!emitir(segundosDesde(inicio) - proximaRafaga)) {
+                        return false;
+                    }
+                }
+                proximaRafaga += configuracion.periodoRafaga;
+            }
+            const double ahora = segundosDesde(inicio);
+            if (proximoInforme <= ahora) {
+                informe(ahora, estadisticas);
+                proximoInforme += 1.0;
+            }
+            
+            double siguiente = proximaLinea < proximoInforme ? proximaLinea : proximoInforme;
+            if (configuracion.rafaga > 0 && proximaRafaga < siguiente) {
+                siguiente = proximaRafaga;
+            }
+            if (siguiente > ahora) {
+                std::this_thread::sleep_until(inicio + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(siguiente)));
+            }
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Espera a que el lector consuma los datos pendientes
+     * @param detener Indicador de interrupcion
+     * @param limite Segundos maximos de espera
+     * @return true si el pty quedo vacio
+     * 
+     * Cerrar el maestro descarta lo que el lector aun no leyo, de modo que
+     * las lineas enviadas al final no llegarian al programa.
+     */
+    bool drenar(const std::atomic<bool>& detener, double limite) const {
+        const int esclavo = open(rutaEsclavo.c_str(), O_RDONLY | O_NOCTTY | O_NONBLOCK);
+        if (esclavo < 0) {
+            return false;
+        }
+        const std::chrono::steady_clock::time_point inicio = std::chrono::steady_clock::now();
+        // Los datos pasan del maestro a la cola del esclavo de forma diferida:
+        // se exigen varias lecturas vacias consecutivas
+        int lecturasVacias = 0;
+        while (!detener.load() && segundosDesde(inicio) < limite && lecturasVacias < 5) {
+            int pendientes = 0;
+            if (ioctl(esclavo, FIONREAD, &pendientes) != 0) {
+                break;
+            }
+            lecturasVacias = pendientes == 0 ? lecturasVacias + 1 : 0;
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        const bool vacio = lecturasVacias >= 5;
+        close(esclavo);
+        return vacio;
+    }
+    
+    const std::string& getRutaEsclavo() const { return rutaEsclavo; }
+    const EstadisticasCarga& getEstadisticas() const { return estadisticas; }
+};
+
+#endif // GENERADORCARGA_H
@@ -0,0 +1,183 @@
+/**
+ * @file generador_carga.cpp
+ * @brief Generador de carga serial sintetica para el sistema de sensores
+ * @author Sistema de Monitoreo
+ * @version 1.0
+ * @date 2024
+ * 
+ * Crea un pseudoterminal y emite por el lineas con el formato del Arduino,
+ * de modo que la opcion 6 del programa principal pueda conectarse a la
+ * ruta informada como si fuera un puerto USB. Permite medir la ingesta y
+ * las perdidas de forma reproducible sin hardware.
+ * 
+ * Uso: generador_carga [opciones]
+ *   --sensores N          Sensores simulados (10)
+ *   --presion F           Fraccion de sensores de presion (0.5)
+ *   --tasa N              Lineas por segundo (100)
+ *   --jitter F            Variacion relativa del intervalo, 0 a 1 (0)
+ *   --rafaga N            Lineas extra por rafaga (0 = sin rafagas)
+ *   --periodo-rafaga S    Segundos entre rafagas (1)
+ *   --malformadas F       Fraccion de lineas invalidas (0)
+ *   --duracion S          Segundos de emision (0 = hasta Ctrl+C)
+ *   --semilla N           Semilla pseudoaleatoria (1)
+ *   --retraso-maximo MS   Atraso tras el cual una linea se descarta (100)
+ *   --bloqueante          No descartar: emitir las lineas atrasadas
+ *   --enlace RUTA         Crear un enlace simbolico RUTA -> pty esclavo
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include "GeneradorCarga.h"
+
+/// Indicador de interrupcion activado por SIGINT o SIGTERM
+static std::atomic<bool> detener(false);
+
+/**
+ * @brief Manejador de senales de terminacion
+ */
+void solicitarDetencion(int) {
+    detener.store(true);
+}
+
+/**
+ * @brief Muestra las opciones disponibles
+ * @param programa Nombre del ejecutable
+ */
+void mostrarUso(const char* programa) {
+    std::cerr << "Uso: " << programa << " [--sensores N] [--presion F] [--tasa N] [--jitter F]\n"
+              << "       [--rafaga N] [--periodo-rafaga S] [--malformadas F] [--duracion S]\n"
+              << "       [--semilla N] [--retraso-maximo MS] [--bloqueante] [--enlace RUTA]" << std::endl;
+}
+
+/**
+ * @brief Imprime una linea de contadores
+ */
+void imprimirContadores(const char* etiqueta, double segundos, const EstadisticasCarga& estadisticas) {
+    std::cout << etiqueta << " t=" << std::fixed << std::setprecision(1) << segundos << "s"
+              << " enviadas=" << estadisticas.enviadas
+              << " malformadas=" << estadisticas.malformadas
+              << " descartadas=" << estadisticas.descartadas
+              << " bytes=" << estadisticas.bytes << std::endl;
+}
+
+/**
+ * @brief Interpreta las opciones de la linea de comandos
+ * @return true si todas las opciones son validas
+ */
+bool interpretarOpciones(int argc, char* argv[], ConfiguracionCarga& configuracion, std::string& enlace) {
+    for (int i = 1; i < argc; i++) {
+        const std::string opcion = argv[i];
+        if (opcion == "--bloqueante") {
+            configuracion.bloqueante = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "[ERROR] Falta el valor de " << opcion << std::endl;
+            return false;
+        }
+        const char* valor = argv[++i];
+        if (opcion == "--sensores") {
+            configuracion.sensores = std::atoi(valor);
+        } else if (opcion == "--presion") {
+            configuracion.fraccionPresion = std::atof(valor);
+        } else if (opcion == "--tasa") {
+            configuracion.tasa = std::atof(valor);
+        } else if (opcion == "--jitter") {
+            configuracion.jitter = std::atof(valor);
+        } else if (opcion == "--rafaga") {
+            configuracion.rafaga = std::atoi(valor);
+        } else if (opcion == "--periodo-rafaga") {
+            configuracion.periodoRafaga = std::atof(valor);
+        } else if (opcion == "--malformadas") {
+            configuracion.fraccionMalformada = std::atof(valor);
+        } else if (opcion == "--duracion") {
+            configuracion.duracion = std::atof(valor);
+        } else if (opcion == "--semilla") {
+            configuracion.semilla = static_cast<unsigned>(std::strtoul(valor, nullptr, 10));
+        } else if (opcion == "--retraso-maximo") {
+            configuracion.retrasoMaximo = std::atof(valor) / 1000.0;
+        } else if (opcion == "--enlace") {
+            enlace = valor;
+        } else {
+            std::cerr << "[ERROR] Opcion no reconocida: " << opcion << std::endl;
+            return false;
+        }
+    }
+    if (configuracion.sensores < 1 || configuracion.tasa <= 0.0 || configuracion.periodoRafaga <= 0.0 ||
+        configuracion.jitter < 0.0 || configuracion.jitter > 1.0 || configuracion.rafaga < 0 ||
+        configuracion.retrasoMaximo < 0.0 ||
+        configuracion.fraccionPresion < 0.0 || configuracion.fraccionPresion > 1.0 ||
+        configuracion.fraccionMalformada < 0.0 || configuracion.fraccionMalformada > 1.0) {
+        std::cerr << "[ERROR] Parametros fuera de rango" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Punto de entrada del generador de carga
+ * @return int 0 si la emision termino normalmente
+ */
+int main(int argc, char* argv[]) {
+    ConfiguracionCarga configuracion;
+    std::string enlace;
+    if (!interpretarOpciones(argc, argv, configuracion, enlace)) {
+        mostrarUso(argv[0]);
+        return 1;
+    }
+    
+    std::signal(SIGINT, solicitarDetencion);
+    std::signal(SIGTERM, solicitarDetencion);
+    
+    GeneradorCarga generador(configuracion);
+    if (!generador.abrir()) {
+        return 1;
+    }
+    if (!enlace.empty()) {
+        unlink(enlace.c_str());
+        if (symlink(generador.getRutaEsclavo().c_str(), enlace.c_str()) != 0) {
+            std::cerr << "[WARN] No se pudo crear el enlace " << enlace << ": " << std::strerror(errno) << std::endl;
+            enlace.clear();
+        }
+    }
+    
+    std::cout << "[OK] Puerto simulado: " << generador.getRutaEsclavo() << std::endl;
+    std::cout << "[OK] Aguardando que un lector abra el puerto..." << std::endl;
+    if (!generador.esperarLector(detener)) {
+        if (!enlace.empty()) {
+            unlink(enlace.c_str());
+        }
+        return 0;
+    }
+    
+    // SerialPort vacia el buffer y espera 2 s al configurar el puerto
+    usleep(2500000);
+    std::cout << "[OK] Lector conectado, emitiendo " << configuracion.tasa << " lineas/s" << std::endl;
+    
+    const bool completo = generador.ejecutar(detener, [](double segundos, const EstadisticasCarga& estadisticas) {
+        imprimirContadores("[INFO]", segundos, estadisticas);
+    });
+    if (!completo) {
+        std::cout << "[WARN] El lector cerro el puerto" << std::endl;
+    }
+    
+    if (completo && !generador.drenar(detener, 5.0)) {
+        std::cout << "[WARN] El lector no consumio todas las lineas pendientes" << std::endl;
+    }
+    
+    const EstadisticasCarga& total = generador.getEstadisticas();
+    std::cout << "[RESUMEN] enviadas=" << total.enviadas << " malformadas=" << total.malformadas
+              << " validas=" << total.enviadas - total.malformadas
+              << " descartadas=" << total.descartadas << " bytes=" << total.bytes << std::endl;
+    if (!enlace.empty()) {
+        unlink(enlace.c_str());
+    }
+    return 0;
+}
@@ -13,16 +13,49 @@
 
 #include <iostream>
 #include <string>
-#include <sstream>
 #include <limits>
+#include <cstdlib>
 #include "SensorBase.h"
 #include "SensorTemperatura.h"
 #include "SensorPresion.h"
 #include "ListaSensor.h"
+#include "ColeccionSensores.h"
+#include "RegistroSensores.h"
+#include "Instantanea.h"
+#include "IndiceSensores.h"
+#include "InformeMemoria.h"
+#include "MotorAlertas.h"
+#include "IngestaSerial.h"
 #include "SerialPort.h"
+#include "ServidorMetricas.h"
 
-// Definicion de tipo para lista polimorfica de sensores
-typedef ListaSensor<SensorBase*> ColeccionSensores;
+/**
+ * @brief Reglas de alerta iniciales para sensores termicos
+ * @return Umbrales de -20 a 60 grados, 5 grados/s, puntaje z 4 y 30 repeticiones
+ */
+ReglasAlerta reglasTermicas() {
+    ReglasAlerta reglas;
+    reglas.maximo = 60.0;
+    reglas.minimo = -20.0;
+    reglas.tasaMaxima = 5.0;
+    reglas.puntajeZMaximo = 4.0;
+    reglas.repeticionesMaximas = 30;
+    return reglas;
+}
+
+/**
+ * @brief Reglas de alerta iniciales para sensores de presion
+ * @return Umbrales de 90000 a 110000 Pa, 500 Pa/s, puntaje z 4 y 30 repeticiones
+ */
+ReglasAlerta reglasPresion() {
+    ReglasAlerta reglas;
+    reglas.maximo = 110000.0;
+    reglas.minimo = 90000.0;
+    reglas.tasaMaxima = 500.0;
+    reglas.puntajeZMaximo = 4.0;
+    reglas.repeticionesMaximas = 30;
+    return reglas;
+}
 
 /**
  * @brief Captura datos del dispositivo Arduino mediante comunicacion serial
@@ -31,17 +64,29 @@ typedef ListaSensor<SensorBase*> ColeccionSensores;
  * via puerto USB y captura datos en tiempo real. Los datos recibidos son
  * parseados y almacenados en la coleccion de sensores.
  * 
- * @param registro Puntero a la coleccion de sensores donde se almacenaran los datos
+ * @param sensores Registro donde se crean los sensores y se almacenan los datos
  * 
  * @details El formato esperado de datos es: TIPO ID VALOR
  *          - TIPO: 'T' para temperatura, 'P' para presion
  *          - ID: Identificador unico del sensor
  *          - VALOR: Medicion numerica (float para temperatura, int para presion)
  * 
+ * Cada medicion se evalua en linea contra las reglas de alerta de su tipo;
+ * las alertas se encolan y las imprime un hilo aparte.
+ * 
+ * Cada linea se interpreta con IngestaSerial, la misma ruta que reproducen
+ * las pruebas de rendimiento. Si el programa se compila con la opcion
+ * SENSORES_INSTRUMENTACION, la senal SIGUSR1 escribe en la salida de
+ * errores los contadores y los histogramas de latencia por etapa.
+ * 
+ * Si la variable de entorno SENSORES_METRICAS indica una direccion
+ * ("9464", "127.0.0.1:9464" o "unix:/ruta"), un hilo aparte sirve
+ * GET /metrics en formato de texto de Prometheus durante la captura.
+ * 
  * @note La funcion entra en un ciclo infinito hasta que se interrumpa con Ctrl+C
  * @warning Requiere permisos de lectura en el puerto serial en sistemas Unix
  */
-void capturarDatosHardware(ColeccionSensores* registro) {
+void capturarDatosHardware(RegistroSensores* sensores) {
     std::cout << "\n+------------------------------------------------+" << std::endl;
     std::cout << "|      CAPTURA DE DATOS DESDE ARDUINO            |" << std::endl;
     std::cout << "+------------------------------------------------+\n" << std::endl;
@@ -77,97 +122,38 @@ void capturarDatosHardware(ColeccionSensores* registro) {
     std::cout << "------------------------------------------------\n" << std::endl;
     
     std::string buffer;
-    int contadorLecturas = 0;
+    
+    // Motor de alertas: evaluacion en linea, despacho en otro hilo
+    ColaSPSC<Alerta> colaAlertas(1024);
+    MotorAlertas alertasTermicas(reglasTermicas(), colaAlertas);
+    MotorAlertas alertasPresion(reglasPresion(), colaAlertas);
+    DespachadorAlertas despachador(colaAlertas);
+    IngestaSerial ingesta(sensores, alertasTermicas, alertasPresion);
+    
+    // Informe de latencias con kill -USR1 (solo con SENSORES_INSTRUMENTACION)
+    INSTRUMENTO_EXPORTADOR(exportador);
+    
+    // Metricas para Prometheus: el ciclo copia su estado una vez por segundo
+    PublicacionMetricas publicacion;
+    ServidorMetricas servidorMetricas(publicacion, colaAlertas);
+    const char* direccionMetricas = std::getenv("SENSORES_METRICAS");
+    if (direccionMetricas != nullptr && servidorMetricas.iniciar(direccionMetricas)) {
+        std::cout << "[OK] Metricas disponibles en " << direccionMetricas << " (GET /metrics)\n" << std::endl;
+    }
+    const bool publicarMetricas = servidorMetricas.estaActivo();
     
     // Ciclo de lectura continua
     while (true) {
         if (conexion.leerLinea(buffer)) {
-            // Filtrar mensajes de sistema del Arduino
-            if (buffer.find("===") != std::string::npos || 
-                buffer.find("Arduino") != std::string::npos ||
-                buffer.find("Formato") != std::string::npos ||
-                buffer.empty()) {
-                continue;
-            }
-            
-            std::cout << "[RX] Datos recibidos: " << buffer << std::endl;
-            
-            // Parseo de la cadena recibida
-            std::istringstream parser(buffer);
-            char tipoDispositivo;
-            std::string identificador;
-            
-            if (!(parser >> tipoDispositivo >> identificador)) {
-                std::cout << "[WARN] Formato de datos incorrecto, descartando..." << std::endl;
-                continue;
-            }
-            
-            // Verificar existencia previa del sensor
-            SensorBase* dispositivoExistente = nullptr;
-            registro->iterar([&dispositivoExistente, &identificador](SensorBase* dispositivo) {
-                if (std::string(dispositivo->getNombre()) == identificador) {
-                    dispositivoExistente = dispositivo;
-                }
-            });
-            
-            if (tipoDispositivo == 'T' || tipoDispositivo == 't') {
-                float medicion;
-                if (!(parser >> medicion)) {
-                    std::cout << "[WARN] Valor de temperatura invalido" << std::endl;
-                    continue;
-                }
-                
-                if (dispositivoExistente == nullptr) {
-                    // Instanciar nuevo sensor termico
-                    SensorTemperatura* nuevoDispositivo = new SensorTemperatura(identificador.c_str());
-                    nuevoDispositivo->agregarLectura(medicion);
-                    registro->insertarAlFinal(nuevoDispositivo);
-                    std::cout << "[OK] Sensor termico '" << identificador << "' registrado" << std::endl;
-                } else {
-                    // Actualizar sensor existente
-                    SensorTemperatura* sensorTermico = dynamic_cast<SensorTemperatura*>(dispositivoExistente);
-                    if (sensorTermico) {
-                        sensorTermico->agregarLectura(medicion);
-                        std::cout << "[OK] Medicion almacenada en '" << identificador << "': " 
-                                  << medicion << " grados C" << std::endl;
-                    }
-                }
-                
-            } else if (tipoDispositivo == 'P' || tipoDispositivo == 'p') {
-                int medicion;
-                if (!(parser >> medicion)) {
-                    std::cout << "[WARN] Valor de presion invalido" << std::endl;
-                    continue;
-                }
-                
-                if (dispositivoExistente == nullptr) {
-                    // Instanciar nuevo sensor de presion
-                    SensorPresion* nuevoDispositivo = new SensorPresion(identificador.c_str());
-                    nuevoDispositivo->agregarLectura(medicion);
-                    registro->insertarAlFinal(nuevoDispositivo);
-                    std::cout << "[OK] Sensor de presion '" << identificador << "' registrado" << std::endl;
-                } else {
-                    // Actualizar sensor existente
-                    SensorPresion* sensorPresion = dynamic_cast<SensorPresion*>(dispositivoExistente);
-                    if (sensorPresion) {
-                        sensorPresion->agregarLectura(medicion);
-                        std::cout << "[OK] Medicion almacenada en '" << identificador << "': " 
-                                  << medicion << " Pascales" << std::endl;
-                    }
-                }
-            } else {
-                std::cout << "[WARN] Tipo de dispositivo no reconocido: " << tipoDispositivo << std::endl;
-                continue;
-            }
-            
-            contadorLecturas++;
-            std::cout << "[INFO] Total de mediciones capturadas: " << contadorLecturas << "\n" << std::endl;
+            ingesta.procesarLinea(buffer);
+        }
+        if (publicarMetricas) {
+            publicacion.publicarSiCorresponde(ingesta, sensores->getColeccion(), RelojMonotonico::ahora());
         }
     }
 }
 
 
-
 /**
  * @brief Despliega el menu principal de opciones del sistema
  * 
@@ -187,6 +173,14 @@ void desplegarMenu() {
     std::cout << "|| 4. Procesar Datos Almacenados  ||" << std::endl;
     std::cout << "|| 5. Finalizar Sistema           ||" << std::endl;
     std::cout << "|| 6. Conectar Arduino (Serial)   ||" << std::endl;
+    std::cout << "|| 7. Guardar Instantanea         ||" << std::endl;
+    std::cout << "|| 8. Cargar Instantanea          ||" << std::endl;
+    std::cout << "|| 9. Consultar Intervalo         ||" << std::endl;
+    std::cout << "|| 10. Ventanas Moviles           ||" << std::endl;
+    std::cout << "|| 11. Percentiles                ||" << std::endl;
+    std::cout << "|| 12. Uso de Memoria             ||" << std::endl;
+    std::cout << "|| 13. Retirar Sensor             ||" << std::endl;
+    std::cout << "|| 14. Listar Sensores            ||" << std::endl;
     std::cout << "||================================||" << std::endl;
     std::cout << "Ingrese su seleccion: ";
 }
@@ -206,6 +200,13 @@ void desplegarMenu() {
  *          - Capturar mediciones manualmente
  *          - Conectar con Arduino via puerto serial
  *          - Procesar datos almacenados
+ *          - Guardar y restaurar el registro mediante instantaneas binarias
+ *          - Consultar agregados de un sensor en un intervalo de tiempo
+ *          - Consultar minimo y media moviles de 1, 5 y 15 minutos
+ *          - Estimar percentiles por sensor y de toda la flota
+ *          - Informar la memoria por sensor frente a un presupuesto
+ *          - Retirar un sensor del registro y liberar su historial
+ *          - Listar los sensores en orden alfabetico, filtrando por prefijo
  *          - Liberar memoria al finalizar
  */
 int main() {
@@ -214,8 +215,10 @@ int main() {
     std::cout << "|  Sistema Polimorfico de Monitoreo             |" << std::endl;
     std::cout << "+------------------------------------------------+\n" << std::endl;
     
-    // Inicializar estructura de datos principal
-    ColeccionSensores* registro = new ColeccionSensores();
+    // Inicializar estructura de datos principal: el registro es duenio de
+    // los sensores y los libera al salir de main por cualquier camino
+    RegistroSensores sensores;
+    const ColeccionSensores* registro = sensores.getColeccion();
     
     int seleccion;
     bool sistemaActivo = true;
@@ -231,8 +234,7 @@ int main() {
                 std::cout << "\nCodigo del dispositivo (ejemplo: TEMP-001): ";
                 std::cin >> codigo;
                 
-                SensorTemperatura* nuevoDispositivo = new SensorTemperatura(codigo.c_str());
-                registro->insertarAlFinal(nuevoDispositivo);
+                sensores.agregarTermico(codigo.c_str());
                 std::cout << "Sensor termico 'T-" << codigo << "' incorporado al sistema" << std::endl;
                 break;
             }
@@ -243,8 +245,7 @@ int main() {
                 std::cout << "\nCodigo del dispositivo (ejemplo: PRES-105): ";
                 std::cin >> codigo;
                 
-                SensorPresion* nuevoDispositivo = new SensorPresion(codigo.c_str());
-                registro->insertarAlFinal(nuevoDispositivo);
+                sensores.agregarPresion(codigo.c_str());
                 std::cout << "Sensor de presion 'P-" << codigo << "' incorporado al sistema" << std::endl;
                 break;
             }
@@ -255,28 +256,20 @@ int main() {
                 std::cout << "\nCodigo del sensor objetivo: ";
                 std::cin >> codigo;
                 
-                SensorBase* dispositivoLocalizado = nullptr;
-                registro->iterar([&dispositivoLocalizado, &codigo](SensorBase* dispositivo) {
-                    if (std::string(dispositivo->getNombre()) == codigo) {
-                        dispositivoLocalizado = dispositivo;
-                    }
-                });
+                SensorBase* dispositivoLocalizado = localizarSensor(&sensores, codigo);
                 
                 if (dispositivoLocalizado != nullptr) {
-                    SensorTemperatura* sensorTermico = dynamic_cast<SensorTemperatura*>(dispositivoLocalizado);
-                    SensorPresion* sensorPresion = dynamic_cast<SensorPresion*>(dispositivoLocalizado);
-                    
-                    if (sensorTermico) {
+                    if (dispositivoLocalizado->getTipo() == SENSOR_TEMPERATURA) {
                         float dato;
                         std::cout << "Valor de medicion (decimal): ";
                         std::cin >> dato;
-                        sensorTermico->agregarLectura(dato);
+                        static_cast<SensorTemperatura*>(dispositivoLocalizado)->agregarLectura(dato);
                         std::cout << "ID: " << codigo << " | Valor: " << dato << " (tipo decimal)" << std::endl;
-                    } else if (sensorPresion) {
+                    } else {
                         int dato;
                         std::cout << "Valor de medicion (entero): ";
                         std::cin >> dato;
-                        sensorPresion->agregarLectura(dato);
+                        static_cast<SensorPresion*>(dispositivoLocalizado)->agregarLectura(dato);
                         std::cout << "ID: " << codigo << " | Valor: " << dato << " (tipo entero)" << std::endl;
                     }
                 } else {
@@ -293,12 +286,9 @@ int main() {
                     std::cout << "\n>> Analizando dispositivo " << dispositivo->getNombre() << "..." << std::endl;
                     
                     // Identificacion del tipo de sensor
-                    SensorTemperatura* sensorTermico = dynamic_cast<SensorTemperatura*>(dispositivo);
-                    SensorPresion* sensorPresion = dynamic_cast<SensorPresion*>(dispositivo);
-                    
-                    if (sensorTermico) {
+                    if (dispositivo->getTipo() == SENSOR_TEMPERATURA) {
                         std::cout << "[Sensor Termico] Calculo de minima ejecutado" << std::endl;
-                    } else if (sensorPresion) {
+                    } else {
                         std::cout << "[Sensor Presion] Calculo de promedio ejecutado" << std::endl;
                     }
                     
@@ -315,13 +305,8 @@ int main() {
                 std::cout << "\n<<< Proceso de cierre iniciado >>>" << std::endl;
                 std::cout << "[Sistema] Liberando recursos de memoria..." << std::endl;
                 
-                // Liberar cada dispositivo del registro
-                registro->iterar([](SensorBase* dispositivo) {
-                    delete dispositivo;
-                });
-                
-                // Limpiar estructura principal
-                delete registro;
+                // Liberar todos los dispositivos del registro
+                sensores.vaciar();
                 
                 std::cout << "Proceso terminado. Memoria liberada correctamente." << std::endl;
                 sistemaActivo = false;
@@ -330,7 +315,156 @@ int main() {
             
             case 6: {
                 // Conexion con Arduino real
-                capturarDatosHardware(registro);
+                capturarDatosHardware(&sensores);
+                break;
+            }
+            
+            case 7: {
+                // Persistencia del registro completo
+                std::string ruta;
+                std::cout << "\nRuta del archivo de instantanea: ";
+                std::cin >> ruta;
+                
+                if (!Instantanea::guardar(*registro, ruta)) {
+                    std::cout << "No fue posible guardar la instantanea" << std::endl;
+                }
+                break;
+            }
+            
+            case 8: {
+                // Restauracion del registro desde archivo
+                if (!registro->estaVacia()) {
+                    std::cout << "\nLa carga requiere un registro vacio (sensores actuales: " 
+                              << registro->getTamanio() << ")" << std::endl;
+                    break;
+                }
+                
+                std::string ruta;
+                std::cout << "\nRuta del archivo de instantanea: ";
+                std::cin >> ruta;
+                
+                if (!Instantanea::cargar(sensores, ruta)) {
+                    std::cout << "La instantanea no se restauro por completo" << std::endl;
+                }
+                break;
+            }
+            
+            case 9: {
+                // Agregados de las mediciones recientes de un sensor
+                std::string codigo;
+                std::cout << "\nCodigo del sensor objetivo: ";
+                std::cin >> codigo;
+                
+                SensorBase* dispositivoLocalizado = localizarSensor(&sensores, codigo);
+                
+                if (dispositivoLocalizado == nullptr) {
+                    std::cout << "Dispositivo no localizado en el registro" << std::endl;
+                    break;
+                }
+                
+                long long segundos;
+                std::cout << "Segundos hacia atras: ";
+                std::cin >> segundos;
+                
+                const MarcaTiempo hasta = RelojMonotonico::ahora() + 1;
+                const ResumenRango resumen = dispositivoLocalizado->consultarRango(hasta - segundos * 1000, hasta);
+                if (resumen.cantidad == 0) {
+                    std::cout << "Sin mediciones en el intervalo" << std::endl;
+                } else {
+                    std::cout << "Mediciones: " << resumen.cantidad
+                              << " | Minimo: " << resumen.minimo
+                              << " | Maximo: " << resumen.maximo
+                              << " | Media: " << resumen.media() << std::endl;
+                }
+                break;
+            }
+            
+            case 10: {
+                // Agregados moviles de todos los sensores
+                const MarcaTiempo ahora = RelojMonotonico::ahora();
+                std::cout << "\n<<< Ventanas moviles (1, 5 y 15 minutos) >>>" << std::endl;
+                registro->iterar([ahora](SensorBase* dispositivo) {
+                    std::cout << dispositivo->getNombre() << ":" << std::endl;
+                    for (int i = 0; i < SensorBase::CANTIDAD_VENTANAS; i++) {
+                        const ResumenRango resumen = dispositivo->consultarVentana(i, ahora);
+                        std::cout << "  " << SensorBase::duracionVentana(i) / 60000 << " min -> ";
+                        if (resumen.cantidad == 0) {
+                            std::cout << "sin mediciones" << std::endl;
+                        } else {
+                            std::cout << "Mediciones: " << resumen.cantidad
+                                      << " | Minimo: " << resumen.minimo
+                                      << " | Media: " << resumen.media() << std::endl;
+                        }
+                    }
+                });
+                break;
+            }
+            
+            case 11: {
+                // Percentiles por sensor y combinados por tipo
+                BocetoCuantiles<float> flotaTermica;
+                BocetoCuantiles<int> flotaPresion;
+                std::cout << "\n<<< Percentiles p50 / p95 / p99 >>>" << std::endl;
+                registro->iterar([&flotaTermica, &flotaPresion](SensorBase* dispositivo) {
+                    std::cout << dispositivo->getNombre() << ": "
+                              << dispositivo->estimarCuantil(0.50) << " / "
+                              << dispositivo->estimarCuantil(0.95) << " / "
+                              << dispositivo->estimarCuantil(0.99) << std::endl;
+                    
+                    if (dispositivo->getTipo() == SENSOR_TEMPERATURA) {
+                        flotaTermica.combinar(static_cast<SensorTemperatura*>(dispositivo)->getBoceto());
+                    } else {
+                        flotaPresion.combinar(static_cast<SensorPresion*>(dispositivo)->getBoceto());
+                    }
+                });
+                if (!flotaTermica.estaVacio()) {
+                    std::cout << "[Flota termica] " << flotaTermica.cuantil(0.50) << " / "
+                              << flotaTermica.cuantil(0.95) << " / " << flotaTermica.cuantil(0.99) << std::endl;
+                }
+                if (!flotaPresion.estaVacio()) {
+                    std::cout << "[Flota de presion] " << flotaPresion.cuantil(0.50) << " / "
+                              << flotaPresion.cuantil(0.95) << " / " << flotaPresion.cuantil(0.99) << std::endl;
+                }
+                break;
+            }
+            
+            case 12: {
+                // Memoria por sensor y ranking de los mas pesados
+                long long kilobytes;
+                std::cout << "\nPresupuesto por sensor en KB (0 = sin limite): ";
+                std::cin >> kilobytes;
+                if (kilobytes < 0) {
+                    std::cout << "Presupuesto no valido" << std::endl;
+                    break;
+                }
+                informarMemoria(registro, static_cast<std::size_t>(kilobytes) * 1024);
+                break;
+            }
+            
+            case 13: {
+                // Baja de un sensor: se desenlaza del registro y se libera
+                std::string codigo;
+                std::cout << "\nCodigo del sensor a retirar: ";
+                std::cin >> codigo;
+                
+                SensorBase* dispositivoLocalizado = localizarSensor(&sensores, codigo);
+                if (dispositivoLocalizado == nullptr) {
+                    std::cout << "Dispositivo no localizado en el registro" << std::endl;
+                    break;
+                }
+                const long long mediciones = dispositivoLocalizado->getCantidadMediciones();
+                sensores.retirar(dispositivoLocalizado);
+                std::cout << "Sensor '" << codigo << "' retirado (" << mediciones
+                          << " mediciones liberadas, quedan " << registro->getTamanio() << " sensores)" << std::endl;
+                break;
+            }
+            
+            case 14: {
+                // Listado ordenado: indice por niveles construido sobre el registro
+                std::string prefijo;
+                std::cout << "\nPrefijo del codigo (* para todos): ";
+                std::cin >> prefijo;
+                listarSensores(registro, prefijo == "*" ? std::string() : prefijo);
                 break;
             }
             